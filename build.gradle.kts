@@ -10,10 +10,16 @@ plugins {
     `maven-publish`
     bridge
     cmake
+    id("org.jetbrains.kotlin.plugin.allopen")
+    alias(libs.plugins.kotlinx.benchmark)
     alias(libs.plugins.dokka)
     alias(libs.plugins.mavenPublisher)
 }
 
+// Desktop targets able to run the kotlinx-benchmark suite in src/commonBenchmark,
+// e.g. `./gradlew jvmBenchmarkBenchmark` or `./gradlew linuxX64BenchmarkBenchmark`.
+val benchmarkTargets = listOf("jvm", "linuxX64", "macosX64", "macosArm64", "mingwX64")
+
 cmake {
     sourceFolder = file("$projectDir/src/cppMain")
 }
@@ -69,6 +75,9 @@ kotlin {
         compilations.all {
             kotlinOptions.jvmTarget = "11"
         }
+        compilations.create("benchmark") {
+            associateWith(this@jvm.compilations.getByName("main"))
+        }
         testRuns["test"].executionTask.configure {
             useJUnitPlatform()
         }
@@ -88,6 +97,11 @@ kotlin {
             sharedLib()
             staticLib()
         }
+        if (it.name in benchmarkTargets) {
+            it.compilations.create("benchmark") {
+                associateWith(it.compilations.getByName("main"))
+            }
+        }
     }
 
     compilerOptions {
@@ -96,7 +110,11 @@ kotlin {
     }
 
     sourceSets {
-        val commonMain by getting { }
+        val commonMain by getting {
+            dependencies {
+                implementation(libs.kotlinx.coroutines.core)
+            }
+        }
         val commonTest by getting {
             dependencies {
                 implementation(libs.kotlin.test)
@@ -129,6 +147,33 @@ kotlin {
                 implementation(libs.bundles.androidx.test)
             }
         }
+
+        benchmarkTargets.forEach {
+            named("${it}Benchmark") {
+                kotlin.srcDir("src/commonBenchmark/kotlin")
+                dependencies {
+                    implementation(libs.kotlinx.benchmark.runtime)
+                }
+            }
+        }
+    }
+}
+
+allOpen {
+    annotation("org.openjdk.jmh.annotations.State")
+}
+
+benchmark {
+    targets {
+        benchmarkTargets.forEach { register("${it}Benchmark") }
+    }
+    configurations {
+        named("main") {
+            warmups = 2
+            iterations = 5
+            iterationTime = 1
+            iterationTimeUnit = "s"
+        }
     }
 }
 
@@ -0,0 +1,43 @@
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.Blackhole
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+import usearch.Matches
+
+/**
+ * Same as [IndexBenchmark], for batches of [QUERIES_SIZE] vectors crossing into the native index in one call,
+ * on one thread or on every context of the index.
+ */
+@State(Scope.Benchmark)
+class BatchBenchmark {
+    @Param("128", "1024")
+    var dimensions = 0
+
+    @Param("F32", "F16", "I8", "B1")
+    var quantization = ""
+
+    @Param("1", "0")
+    var threads = 0
+
+    private lateinit var data: BenchmarkData
+    private var nextKey = DATASET_SIZE.toULong()
+
+    @Setup
+    fun setup() {
+        data = BenchmarkData(dimensions, quantization, threads.toULong())
+    }
+
+    @Benchmark
+    fun searchBatch(): List<Matches> = data.index.searchBatch(data.queries, K, threads.toULong())
+
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Benchmark
+    fun addAll(blackhole: Blackhole) {
+        val keys = ULongArray(QUERIES_SIZE) { nextKey + it.toULong() }
+        data.index.asF32.addAll(keys, data.queries, threads.toULong())
+        nextKey += QUERIES_SIZE.toULong()
+        blackhole.consume(nextKey)
+    }
+}
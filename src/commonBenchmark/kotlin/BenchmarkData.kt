@@ -0,0 +1,31 @@
+import usearch.Index
+import usearch.IndexOptions
+import usearch.MetricKind
+import usearch.ScalarKind
+import kotlin.random.Random
+
+const val DATASET_SIZE = 10_000
+const val QUERIES_SIZE = 100
+const val K = 10
+
+/**
+ * Random dataset and queries shared by the benchmarks, with an index holding the dataset.
+ * Binary quantization compares with Hamming distances, the others with cosine ones.
+ */
+@OptIn(ExperimentalUnsignedTypes::class)
+class BenchmarkData(dimensions: Int, quantization: String, threads: ULong = 0u) {
+    val queries: FloatArray
+    val queryRows: List<FloatArray>
+    val index: Index
+
+    init {
+        val random = Random(42)
+        val vectors = FloatArray(DATASET_SIZE * dimensions) { random.nextFloat() * 2 - 1 }
+        queries = FloatArray(QUERIES_SIZE * dimensions) { random.nextFloat() * 2 - 1 }
+        queryRows = List(QUERIES_SIZE) { queries.copyOfRange(it * dimensions, (it + 1) * dimensions) }
+        val kind = ScalarKind.valueOf(quantization)
+        val metric = if (kind == ScalarKind.B1) MetricKind.Hamming else MetricKind.Cos
+        index = Index(IndexOptions(dimensions.toULong(), metric, kind))
+        index.asF32.addAll(ULongArray(DATASET_SIZE) { it.toULong() }, vectors, threads)
+    }
+}
@@ -0,0 +1,42 @@
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.Blackhole
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+import usearch.Matches
+
+/**
+ * Measures the cost of reaching the native index through the binding of the current platform, one call at a time.
+ * Compare with `ksearch_bench`, which measures the C API directly and reports recall, to see what the crossing costs.
+ */
+@State(Scope.Benchmark)
+class IndexBenchmark {
+    @Param("128", "1024")
+    var dimensions = 0
+
+    @Param("F32", "F16", "I8", "B1")
+    var quantization = ""
+
+    private lateinit var data: BenchmarkData
+    private var nextQuery = 0
+    private var nextKey = DATASET_SIZE.toULong()
+
+    @Setup
+    fun setup() {
+        data = BenchmarkData(dimensions, quantization)
+    }
+
+    @Benchmark
+    fun search(): Matches {
+        val query = data.queryRows[nextQuery]
+        nextQuery = (nextQuery + 1) % QUERIES_SIZE
+        return data.index.search(query, K)
+    }
+
+    @Benchmark
+    fun add(blackhole: Blackhole) {
+        data.index.asF32.add(nextKey, data.queryRows[(nextKey % QUERIES_SIZE.toULong()).toInt()])
+        blackhole.consume(nextKey++)
+    }
+}
@@ -0,0 +1,22 @@
+package usearch
+
+/**
+ * How [Index.searchGrouped] scores a key from the distances of its vectors.
+ */
+expect enum class Aggregation {
+    /**
+     * Distance of the closest vector of the key.
+     */
+    Min,
+
+    /**
+     * Mean distance of the vectors of the key that were among the candidates.
+     */
+    Mean,
+
+    /**
+     * Sum of the `topM` smallest distances of the key among the candidates, favoring keys with many close vectors.
+     * A key with fewer candidates counts the distance of the farthest candidate for each missing one.
+     */
+    TopSum
+}
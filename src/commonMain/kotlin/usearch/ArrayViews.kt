@@ -0,0 +1,25 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+/**
+ * Read-only list over the first [size] keys of [array], without copying or boxing them up front.
+ */
+internal class ULongArrayView(private val array: ULongArray, size: Int) : DelegatedList<ULong>(size) {
+    init {
+        require(size in 0..array.size) { "size $size exceeds the array of ${array.size}" }
+    }
+
+    override fun get(index: Int): ULong = array[checkIndex(index)]
+}
+
+/**
+ * Read-only list over the first [size] distances of [array], without copying or boxing them up front.
+ */
+internal class FloatArrayView(private val array: FloatArray, size: Int) : DelegatedList<Float>(size) {
+    init {
+        require(size in 0..array.size) { "size $size exceeds the array of ${array.size}" }
+    }
+
+    override fun get(index: Int): Float = array[checkIndex(index)]
+}
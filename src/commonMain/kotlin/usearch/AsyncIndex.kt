@@ -0,0 +1,85 @@
+package usearch
+
+import kotlinx.coroutines.suspendCancellableCoroutine
+import kotlinx.coroutines.sync.Semaphore
+
+/**
+ * Suspending front of an [Index] for coroutines. Requests are queued to native threads owned by the index,
+ * which answer them together in micro-batches, so callers never block a dispatcher thread on a native call,
+ * and the threads of callers and of USearch don't oversubscribe the cores.
+ * Requests in flight together run concurrently, in no particular order.
+ * An index serves one [AsyncIndex] at a time, and other operations changing its structure,
+ * like [Index.loadFile] or [Index.reserve], must not run while requests are pending.
+ * @param index the index to answer the requests.
+ * @param depth number of pending requests above which callers suspend until one is answered.
+ * @param batchSize upper bound on the number of requests answered together.
+ * @param threads upper bound on the number of native threads, `0` to use every search context of the index.
+ */
+class AsyncIndex(val index: Index, depth: Int = 256, batchSize: Int = 32, threads: ULong = 0u) {
+    private val slots: Semaphore
+
+    init {
+        if (depth < 1 || batchSize < 1) {
+            throw IllegalArgumentException("Queue depth $depth and batch size $batchSize must be positive.")
+        }
+        slots = Semaphore(depth)
+        index.startQueue(depth, batchSize, threads)
+    }
+
+    /**
+     * Same as [Index.search], suspending until the neighbors are found.
+     * Cancellation doesn't withdraw a queued search, whose results are then dropped.
+     * @throws IllegalArgumentException if [query] doesn't have [Index.dimensions] scalars.
+     */
+    suspend fun search(query: FloatArray, count: Int): Matches {
+        checkLength(query)
+        return submit { done -> index.submitSearch(query, count, done) }
+    }
+
+    /**
+     * Same as [IndexQuery.add] of [Index.asF32], suspending until the vector is added.
+     * Cancellation doesn't withdraw a queued insertion.
+     * @throws IllegalArgumentException if [vector] doesn't have [Index.dimensions] scalars.
+     */
+    suspend fun add(key: ULong, vector: FloatArray) {
+        checkLength(vector)
+        submit<Unit> { done -> index.submitAdd(key, vector, done) }
+    }
+
+    /**
+     * Answers the pending requests and stops the native threads. Further requests fail.
+     * Must not run on the native thread completing requests, e.g. in a coroutine resumed there through
+     * `Dispatchers.Unconfined`: it then returns without waiting, and the threads stop on their own.
+     */
+    fun close() {
+        index.stopQueue()
+    }
+
+    // The native queue copies a whole vector of the index out of every request.
+    private fun checkLength(vector: FloatArray) {
+        if (vector.size.toULong() != index.dimensions) {
+            throw IllegalArgumentException("Vector has ${vector.size} scalars instead of ${index.dimensions}.")
+        }
+    }
+
+    // A slot is held until the native side completes the request, even if the caller is cancelled meanwhile,
+    // so the native queue never holds more than `depth` requests.
+    private suspend fun <T> submit(send: (done: (Result<T>) -> Unit) -> Boolean): T {
+        slots.acquire()
+        return suspendCancellableCoroutine { continuation ->
+            val accepted = try {
+                send { result ->
+                    slots.release()
+                    continuation.resumeWith(result)
+                }
+            } catch (e: Throwable) {
+                slots.release()
+                throw e
+            }
+            if (!accepted) {
+                slots.release()
+                throw IllegalStateException("The request queue is full, is another AsyncIndex using it?")
+            }
+        }
+    }
+}
@@ -0,0 +1,21 @@
+package usearch
+
+/**
+ * Effectiveness of the search result cache, see [Index.cacheCapacity].
+ */
+data class CacheStats(
+    /**
+     * Searches answered from the cache.
+     */
+    val hits: ULong,
+
+    /**
+     * Searches that went to the graph, including those that found a stale result.
+     */
+    val misses: ULong,
+
+    /**
+     * Results held, stale ones included until they are looked up again or evicted.
+     */
+    val entries: ULong,
+)
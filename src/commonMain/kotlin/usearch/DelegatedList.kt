@@ -35,7 +35,7 @@ abstract class DelegatedList<T>(override val size: Int) : List<T> {
 
         override fun previous(): T = get(--currIdx)
 
-        override fun nextIndex(): Int = currIdx + 1
+        override fun nextIndex(): Int = currIdx
 
         override fun previousIndex(): Int = currIdx - 1
     }
@@ -44,9 +44,35 @@ abstract class DelegatedList<T>(override val size: Int) : List<T> {
 
     override fun listIterator(index: Int): ListIterator<T> = DelegatedListIterator(index)
 
-    inner class OffsetDelegatedList(private val offset: Int): DelegatedList<T>(size - offset) {
-        override fun get(index: Int): T = this@DelegatedList[index + offset]
+    inner class OffsetDelegatedList(private val offset: Int, size: Int) : DelegatedList<T>(size) {
+        override fun get(index: Int): T = this@DelegatedList[checkIndex(index) + offset]
     }
 
-    override fun subList(fromIndex: Int, toIndex: Int): List<T> = OffsetDelegatedList(fromIndex)
+    override fun subList(fromIndex: Int, toIndex: Int): List<T> {
+        if (fromIndex < 0 || toIndex > size || fromIndex > toIndex) {
+            throw IndexOutOfBoundsException("fromIndex: $fromIndex, toIndex: $toIndex, size: $size")
+        }
+        return OffsetDelegatedList(fromIndex, toIndex - fromIndex)
+    }
+
+    /**
+     * @return [index] if it is within bounds.
+     * @throws IndexOutOfBoundsException otherwise.
+     */
+    protected fun checkIndex(index: Int): Int {
+        if (index < 0 || index >= size) {
+            throw IndexOutOfBoundsException("index $index is out of bounds for size $size")
+        }
+        return index
+    }
+
+    override fun equals(other: Any?): Boolean {
+        if (this === other) return true
+        if (other !is List<*> || other.size != size) return false
+        return (0 until size).all { get(it) == other[it] }
+    }
+
+    override fun hashCode(): Int = (0 until size).fold(1) { hash, index -> 31 * hash + get(index).hashCode() }
+
+    override fun toString(): String = joinToString(prefix = "[", postfix = "]")
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+package usearch
+
+/**
+ * Distances from [query] to every row of [matrix], computed with one SIMD kernel resolved up front
+ * instead of one per pair, which makes re-ranking candidates far cheaper than comparing them one by one.
+ * Large inputs are split across threads.
+ * @param query the vector to compare against.
+ * @param matrix vectors laid out row after row, `query.size` scalars each.
+ * @param metric the metric used for distance calculation between vectors.
+ * @param threads upper bound on the number of threads to use, `0` to use all cores.
+ * @return one distance per row of [matrix], in the same order.
+ */
+expect fun distances(query: FloatArray, matrix: FloatArray, metric: MetricKind, threads: ULong = 0u): FloatArray
+
+/**
+ * Distances from every row of [queries] to every row of [matrix]. Rows of [matrix] are processed in tiles that stay
+ * in cache while all queries pass over them.
+ * @param queries vectors laid out row after row, [dimensions] scalars each.
+ * @param matrix vectors laid out the same way as [queries].
+ * @param dimensions the number of scalars in every vector.
+ * @param metric the metric used for distance calculation between vectors.
+ * @param threads upper bound on the number of threads to use, `0` to use all cores.
+ * @return a row-major matrix with one row per query and one column per row of [matrix].
+ */
+expect fun distanceMatrix(
+    queries: FloatArray,
+    matrix: FloatArray,
+    dimensions: ULong,
+    metric: MetricKind,
+    threads: ULong = 0u
+): FloatArray
@@ -0,0 +1,28 @@
+package usearch
+
+/**
+ * Multi-threaded many-to-many exact nearest neighbors search, handy for re-ranking
+ * and for generating the ground truth to measure the recall of an [Index] against.
+ * @param dataset vectors to search among, laid out row after row, [dimensions] scalars each.
+ * @param queries query vectors laid out the same way as [dataset].
+ * @param dimensions the number of scalars in every vector.
+ * @param count upper bound on the number of neighbors to search for every query.
+ * @param metric the metric used for distance calculation between vectors.
+ * @param threads upper bound on the number of threads to use, `0` to use all cores.
+ * @return one [Matches] per query, whose keys are the row indices into [dataset].
+ */
+expect fun exactSearch(
+    dataset: FloatArray,
+    queries: FloatArray,
+    dimensions: ULong,
+    count: Int,
+    metric: MetricKind,
+    threads: ULong = 0u
+): List<Matches>
+
+internal fun checkMatrix(matrix: FloatArray, dimensions: Int, name: String): Int {
+    if (dimensions <= 0 || matrix.size % dimensions != 0) {
+        throw IllegalArgumentException("Cannot split ${matrix.size} scalars of $name into $dimensions-dimensional rows.")
+    }
+    return matrix.size / dimensions
+}
@@ -1,5 +1,7 @@
 package usearch
 
+import kotlin.time.Duration
+
 expect class Index(options: IndexOptions) {
     /**
      * The expansion factor used for index construction when adding vectors.
@@ -36,6 +38,43 @@ expect class Index(options: IndexOptions) {
      */
     val memoryUsage: ULong
 
+    /**
+     * Splits [memoryUsage] into its main consumers. Walks every node of the graph, so it's not for hot paths.
+     */
+    val memoryBreakdown: MemoryBreakdown
+
+    /**
+     * Reports how many removed vectors still occupy slots and are traversed during search,
+     * until the next [compact]. Counting them walks the whole graph.
+     */
+    val tombstones: ULong
+
+    /**
+     * Whether searches and insertions are counted and timed into [stats]. Off by default,
+     * in which case operations only pay for checking the flag.
+     * Turning it off keeps the counters, turning it back on continues from them.
+     */
+    var statsEnabled: Boolean
+
+    /**
+     * Work done by this index while [statsEnabled] was on, since the last [resetStats].
+     * Counters are summed without stopping concurrent operations, so they may be slightly inconsistent with each other.
+     */
+    val stats: IndexStats
+
+    /**
+     * Number of search results kept to answer repeated queries of [IndexQuery.search] without touching the graph,
+     * `0` by default, which disables the cache. Results are keyed by the query, the number of results and
+     * [expansionSearch], and any change to the index makes them stale, so it only pays off for hot queries
+     * on indexes that are mostly read. Changing it drops the cached results.
+     */
+    var cacheCapacity: ULong
+
+    /**
+     * Hits and misses of the cache since [cacheCapacity] was last set.
+     */
+    val cacheStats: CacheStats
+
     /**
      * Reports the SIMD capabilities used by the index on the current CPU.
      */
@@ -52,11 +91,32 @@ expect class Index(options: IndexOptions) {
      */
     fun remove(key: ULong)
 
+    /**
+     * Reclaims the slots of removed vectors, so that they are no longer traversed during search.
+     * Neighbors of removed nodes are relinked to each other first, then the index is rebuilt without the dead slots.
+     * Other operations on this index must not run concurrently.
+     * @param threads upper bound on the number of threads to use, `0` to use every available core.
+     */
+    fun compact(threads: ULong = 0u)
+
+    /**
+     * Zeroes all counters and histograms of [stats].
+     */
+    fun resetStats()
+
     /**
      * Reserves memory for a specified number of incoming vectors.
      */
     fun reserve(capacity: ULong)
 
+    /**
+     * Updates how the index grows its capacity once insertions run out of it.
+     * The new capacity is the current one multiplied by [factor], but at least [minStep] slots larger.
+     * @param factor multiplier applied to the current capacity, at least `1`.
+     * @param minStep lower bound on the number of slots added in one step.
+     */
+    fun changeGrowthPolicy(factor: Float, minStep: ULong)
+
     /**
      * CRUD in single precision floating point mode.
      */
@@ -89,6 +149,67 @@ expect class Index(options: IndexOptions) {
      */
     fun search(query: FloatArray, count: Int): Matches
 
+    /**
+     * Same as [search], but only matches keys admitted by [filter], e.g. those of a tenant.
+     * The filter is evaluated in native code, so it costs no crossing per visited node.
+     * @param filter the native key predicate, which may be shared by concurrent searches.
+     */
+    fun search(query: FloatArray, count: Int, filter: KeyFilter): Matches
+
+    /**
+     * Two-stage search for quantized indexes. Traverses the graph for `count * oversample` candidates
+     * with quantized distances, then re-ranks them with exact distances against the full-precision vectors
+     * in [store], giving close to `f32` recall at the memory cost of the quantized index.
+     * Candidates missing from [store] are dropped.
+     * @param oversample how many candidates to fetch for every match, at least `1`.
+     * @throws IllegalArgumentException if [query] doesn't have [dimensions] scalars.
+     */
+    fun searchReranked(query: FloatArray, count: Int, store: VectorStore, oversample: Int = 4): Matches
+
+    /**
+     * Same as [search], but writes up to [SearchBuffer.capacity] neighbors into a reusable [buffer],
+     * allocating nothing per result, for steady-state search at a high rate.
+     * @return the number of neighbors found, also available as [SearchBuffer.size].
+     */
+    fun search(query: FloatArray, buffer: SearchBuffer): Int
+
+    /**
+     * Performs k-Approximate Nearest Neighbors (kANN) Search for a batch of queries in one native call,
+     * answering them in parallel.
+     * @param queries query vectors laid out row after row, [dimensions] scalars each.
+     * @param count upper bound on the number of neighbors to search for every query.
+     * @param threads upper bound on the number of threads to use, `0` to use every search context.
+     * @return one [Matches] per query, in the order of [queries].
+     */
+    fun searchBatch(queries: FloatArray, count: Int, threads: ULong = 0u): List<Matches>
+
+    /**
+     * Range search: finds the neighbors no farther than [radius] from [query], closest first,
+     * e.g. to find near-duplicates. Rounds of kANN searches ask for twice as many neighbors each,
+     * until the farthest one is out of range, so the cost follows the number of matches.
+     * @param radius largest distance of a match, inclusive.
+     * @param maxResults upper bound on the number of matches.
+     */
+    fun searchWithin(query: FloatArray, radius: Float, maxResults: Int = 1024): Matches
+
+    /**
+     * Same as [searchWithin], for a batch of queries answered in parallel in one native call.
+     * @param queries query vectors laid out row after row, [dimensions] scalars each.
+     * @param threads upper bound on the number of threads to use, `0` to use every search context.
+     * @return one [Matches] per query, in the order of [queries].
+     */
+    fun searchWithinBatch(queries: FloatArray, radius: Float, maxResults: Int = 1024, threads: ULong = 0u): List<Matches>
+
+    /**
+     * Finds the [count] closest distinct keys, for [IndexOptions.multi] indexes holding many vectors per key,
+     * e.g. the chunks of a document. Rounds of kANN searches ask for twice as many candidates each,
+     * until enough distinct keys are among them.
+     * @param aggregation how the distances of the vectors of a key are combined into its distance.
+     * @param topM number of distances summed by [Aggregation.TopSum], ignored otherwise.
+     * @return distinct keys with their aggregated distances, best first.
+     */
+    fun searchGrouped(query: FloatArray, count: Int, aggregation: Aggregation = Aggregation.Min, topM: Int = 1): Matches
+
     /**
      *  @brief Checks if the index contains a vector with a specific key.
      *  @param key The key to be checked.
@@ -102,6 +223,24 @@ expect class Index(options: IndexOptions) {
      */
     fun loadFile(filePath: String)
 
+    /**
+     * Memory-maps the index from a file instead of copying it into memory. Pages are read
+     * lazily as searches touch them, so even huge indexes serve queries right away, while the page cache
+     * fills in the rest. The resulting index is read-only.
+     * @param filePath path of the file to view, which must stay unmodified while viewed.
+     * @param advice the expected access pattern, passed to the kernel as a hint.
+     */
+    fun viewFile(filePath: String, advice: ViewAdvice = ViewAdvice.Normal)
+
+    /**
+     * Loads the index from a file into memory backed by huge pages, so that searches over a large graph
+     * miss the TLB less often. Explicit huge pages are used if the system reserved some,
+     * transparent huge pages otherwise, and regular memory outside of Linux.
+     * Like with [viewFile], the resulting index is read-only.
+     * @param filePath path of the file to load.
+     */
+    fun loadHugePages(filePath: String)
+
     /**
      * Loads the index from an in-memory buffer.
      * @param buffer the buffer to load.
@@ -114,12 +253,93 @@ expect class Index(options: IndexOptions) {
      */
     fun saveFile(filePath: String)
 
+    /**
+     * Saves the index chunk by chunk, in constant memory, e.g. to a socket or an object storage upload.
+     * @param bufferSize size of the buffer reused across chunks.
+     * @param write consumes the first `length` bytes of `buffer`, which is overwritten after it returns.
+     */
+    fun saveStream(bufferSize: Int = STREAM_BUFFER_SIZE, write: (buffer: ByteArray, length: Int) -> Unit)
+
+    /**
+     * Loads the index chunk by chunk, in constant memory besides the index itself.
+     * Never reads past the end of the serialized index.
+     * @param bufferSize size of the buffer reused across chunks.
+     * @param read reads up to `length` bytes into the start of `buffer`,
+     * returning how many it did, or a non-positive number at the end of the stream.
+     * @throws USearchException if the stream ends early or is malformed.
+     */
+    fun loadStream(bufferSize: Int = STREAM_BUFFER_SIZE, read: (buffer: ByteArray, length: Int) -> Int)
+
     /**
      * Saves the index to an in-memory buffer.
      * @param buffer the buffer to save to.
      */
     fun saveBuffer(buffer: ByteArray)
 
+    /**
+     * Attaches a write-ahead log, so that changes are durable without saving the whole index every time.
+     * Records already in the log are first replayed, so this is how an index recovers after [loadFile]
+     * of the last snapshot. From then on, every [IndexQuery.add], [IndexQuery.addAll] and [remove] appends a record.
+     * Records survive a crash of the process right away, and a crash of the machine once synced.
+     * Other operations on this index must not run concurrently.
+     * @param filePath path of the log, created if missing.
+     * @param syncEvery number of records after which the log is synced to the storage device,
+     * `1` to sync every change, `0` to only sync in [syncLog] and [checkpoint].
+     * @return the number of records replayed.
+     */
+    fun openLog(filePath: String, syncEvery: ULong = 64u): ULong
+
+    /**
+     * Syncs the records appended to the log so far to the storage device.
+     * @throws USearchException also if a background checkpoint failed since the last call.
+     */
+    fun syncLog()
+
+    /**
+     * Syncs and detaches the log, so that further changes are no longer recorded.
+     */
+    fun closeLog()
+
+    /**
+     * Saves a full snapshot and empties the log. The snapshot is written next to [filePath] and moved over it
+     * once synced, so a crash leaves either the old snapshot with the whole log, or the new one, still with
+     * the whole log if the crash came before it was emptied. Replaying that log again is harmless with key lookups,
+     * but duplicates the logged vectors of [IndexOptions.multi] indexes and of indexes without key lookups.
+     * With [IndexOptions.threadSafe], changes wait until the snapshot is written while searches go on.
+     * Otherwise no other change to the index may run concurrently.
+     * @param filePath path of the snapshot.
+     */
+    fun checkpoint(filePath: String)
+
+    /**
+     * Runs [checkpoint] every [interval] on a background thread, until called again or the index is freed.
+     * Requires [IndexOptions.threadSafe].
+     * @param interval time between checks, [Duration.ZERO] to stop checkpointing.
+     * @param minRecords number of logged records below which a check skips the checkpoint.
+     */
+    fun checkpointEvery(filePath: String, interval: Duration, minRecords: ULong = 0u)
+
+    /**
+     * Starts the native request queue behind [AsyncIndex].
+     */
+    internal fun startQueue(depth: Int, batchSize: Int, threads: ULong)
+
+    /**
+     * Stops the native request queue once the pending requests are answered.
+     */
+    internal fun stopQueue()
+
+    /**
+     * Queues a search, [done] being called on the dispatcher thread unless this returns `false` or throws.
+     * @return `false` if the queue is full.
+     */
+    internal fun submitSearch(query: FloatArray, count: Int, done: (Result<Matches>) -> Unit): Boolean
+
+    /**
+     * Queues an insertion, like [submitSearch].
+     */
+    internal fun submitAdd(key: ULong, vector: FloatArray, done: (Result<Unit>) -> Unit): Boolean
+
     companion object {
         /**
          * Default memory reservation amount of the index.
@@ -127,9 +347,20 @@ expect class Index(options: IndexOptions) {
         val INITIAL_CAPACITY: Long
 
         /**
-         * Default memory allocation when incoming insertion fails with
-         * inadequate capacity.
+         * Default lower bound on the number of slots added when an
+         * insertion runs out of capacity.
          */
         val INCREMENTAL_CAPACITY: Long
+
+        /**
+         * Default multiplier applied to the capacity when an insertion
+         * runs out of it.
+         */
+        val GROWTH_FACTOR: Float
+
+        /**
+         * Default size of the buffer reused by [saveStream] and [loadStream].
+         */
+        val STREAM_BUFFER_SIZE: Int
     }
 }
\ No newline at end of file
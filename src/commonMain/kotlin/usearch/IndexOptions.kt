@@ -3,7 +3,7 @@ package usearch
 /**
  * The index options used to configure the dense index during creation.
  * It contains the number of dimensions, the metric kind, the scalar kind, the connectivity,
- * the expansion values, and the multi-flag.
+ * the expansion values, the multi-flag, whether structural changes are synchronized and how keys are looked up.
  */
 data class IndexOptions(
     /**
@@ -51,5 +51,20 @@ data class IndexOptions(
     /**
      *  When set allows multiple vectors to map to the same key.
      */
-    val multi: Boolean = false
+    val multi: Boolean = false,
+
+    /**
+     *  When set, structural changes like [Index.reserve], [Index.loadFile], [Index.viewFile],
+     *  [Index.compact] or a new [Index.metricKind] wait for in-flight operations, so that they may run concurrently
+     *  with adds and searches from other threads. Searches only take a shared lock and never block each other.
+     *  Without it, adds that outgrow the capacity reallocate the index and must not run alongside other calls,
+     *  unless the room was made ahead with [Index.reserve].
+     */
+    val threadSafe: Boolean = false,
+
+    /**
+     *  How the index finds a vector by its key. Indexes keyed by their insertion order can skip the table
+     *  with [KeyLookups.Identity], saving memory and insertion time.
+     */
+    val keyLookups: KeyLookups = KeyLookups.Hash
 )
@@ -1,3 +1,5 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
 package usearch
 
 interface IndexQuery<T> {
@@ -9,6 +11,37 @@ interface IndexQuery<T> {
      */
     fun add(key: ULong, vec: T)
 
+    /**
+     * Adds a batch of vectors with their keys to the index in one native call,
+     * inserting them in parallel.
+     * @param keys the keys associated with each row of [matrix].
+     * @param matrix the vectors to add, laid out row after row, one row per key.
+     * @param threads upper bound on the number of threads to use, `0` to use every add context.
+     * @throws USearchException when [IndexOptions.multi] is off and any key already exists.
+     */
+    fun addAll(keys: ULongArray, matrix: T, threads: ULong = 0u)
+
+    /**
+     * Searches for the nearest neighbors of a query in this scalar kind,
+     * without widening it to f32 first.
+     * @param query the query vector.
+     * @param count upper bound of result amount.
+     */
+    fun search(query: T, count: Int): Matches
+
+    /**
+     * Same as [search], but only matches keys admitted by [filter].
+     * @param filter the native key predicate, which may be shared by concurrent searches.
+     */
+    fun search(query: T, count: Int, filter: KeyFilter): Matches
+
+    /**
+     * Same as [search], but writes up to [SearchBuffer.capacity] neighbors into a reusable [buffer],
+     * allocating nothing per result.
+     * @return the number of neighbors found, also available as [SearchBuffer.size].
+     */
+    fun search(query: T, buffer: SearchBuffer): Int
+
     /**
      * Retrieves the vector associated with the given key from the index.
      * @param key the key of the vector to retrieve.
@@ -21,4 +54,13 @@ interface IndexQuery<T> {
      * @param count upper bound of result amount.
      */
     operator fun get(key: ULong, count: ULong): List<T>
+
+    /**
+     * Retrieves the vectors of many keys in one native call, as a single flat matrix
+     * laid out row after row in the order of [keys]. Rows of missing keys are left zeroed.
+     * Rows of [ScalarKind.B1] vectors are packed into `ceil(dimensions / 8)` bytes.
+     * @param keys the keys of the vectors to retrieve.
+     * @param threads upper bound on the number of threads to use, `0` to use every available core.
+     */
+    fun getAll(keys: ULongArray, threads: ULong = 0u): T
 }
@@ -0,0 +1,122 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+
+/**
+ * Work done by an [Index] since [Index.statsEnabled] was first turned on or [Index.resetStats] was last called.
+ */
+data class IndexStats(
+    /**
+     * Number of searches, counting every query of a batch.
+     */
+    val searches: ULong,
+
+    /**
+     * Number of graph nodes whose neighbors were expanded, by searches and insertions together.
+     * Growing hops per search hint at a degraded graph or an [Index.expansionSearch] set too high.
+     */
+    val hops: ULong,
+
+    /**
+     * Number of distances computed, by searches and insertions together.
+     */
+    val distances: ULong,
+
+    /**
+     * Number of candidates rejected by [KeyFilter]s.
+     */
+    val filtered: ULong,
+
+    /**
+     * Number of vectors added.
+     */
+    val adds: ULong,
+
+    /**
+     * Distribution of search latencies.
+     */
+    val searchLatency: LatencyHistogram,
+
+    /**
+     * Distribution of insertion latencies.
+     */
+    val addLatency: LatencyHistogram
+)
+
+/**
+ * Log-linear latency histogram with 8 buckets per power of two of nanoseconds,
+ * so every value is known within 12.5%.
+ */
+class LatencyHistogram internal constructor(private val buckets: ULongArray) {
+    /**
+     * Number of latencies recorded in each bucket, see [lowerBound].
+     */
+    val counts: List<ULong> get() = buckets.asList()
+
+    /**
+     * Number of latencies recorded.
+     */
+    val total: ULong get() = buckets.sum()
+
+    /**
+     * Smallest latency at or below which [fraction] of the recorded ones fall,
+     * rounded up to the end of its bucket, or [Duration.ZERO] if nothing was recorded.
+     * @param fraction between `0` and `1`, e.g. `0.99` for the 99th percentile.
+     */
+    fun percentile(fraction: Double): Duration {
+        require(fraction in 0.0..1.0) { "Fraction $fraction is not between 0 and 1." }
+        val total = total
+        if (total == 0uL) {
+            return Duration.ZERO
+        }
+        val rank = maxOf(1uL, (total.toDouble() * fraction).toULong())
+        var seen = 0uL
+        buckets.forEachIndexed { bucket, count ->
+            seen += count
+            if (seen >= rank) {
+                return if (bucket == buckets.lastIndex) lowerBound(bucket) else lowerBound(bucket + 1)
+            }
+        }
+        return lowerBound(buckets.lastIndex)
+    }
+
+    override fun equals(other: Any?): Boolean = other is LatencyHistogram && buckets.contentEquals(other.buckets)
+
+    override fun hashCode(): Int = buckets.contentHashCode()
+
+    override fun toString(): String = "LatencyHistogram(total=$total, p50=${percentile(0.5)}, p99=${percentile(0.99)})"
+
+    companion object {
+        /**
+         * Number of buckets, matching `USEARCH_LATENCY_BUCKETS` of the C library.
+         */
+        const val BUCKETS: Int = 256
+
+        /**
+         * Shortest latency recorded in [bucket]. The last bucket also holds everything slower than about 16 seconds.
+         */
+        fun lowerBound(bucket: Int): Duration =
+            if (bucket < 8) bucket.nanoseconds else ((8L + bucket % 8) shl (bucket / 8 - 1)).nanoseconds
+    }
+}
+
+/**
+ * Number of values [indexStatsOf] reads: the five counters, then both histograms.
+ */
+internal const val INDEX_STATS_LENGTH: Int = 5 + 2 * LatencyHistogram.BUCKETS
+
+internal fun indexStatsOf(values: ULongArray): IndexStats {
+    val histograms = 5 + LatencyHistogram.BUCKETS
+    return IndexStats(
+        searches = values[0],
+        hops = values[1],
+        distances = values[2],
+        filtered = values[3],
+        adds = values[4],
+        searchLatency = LatencyHistogram(values.copyOfRange(5, histograms)),
+        addLatency = LatencyHistogram(values.copyOfRange(histograms, INDEX_STATS_LENGTH))
+    )
+}
@@ -0,0 +1,33 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+/**
+ * Data structure a [KeyFilter] keeps its keys in.
+ */
+expect enum class FilterKind {
+    /**
+     * Roaring-style bitset, compact and fast for dense or clustered key ranges.
+     */
+    Bitset,
+
+    /**
+     * Sorted key array, smallest for few scattered keys, looked up by binary search.
+     */
+    Sorted,
+
+    /**
+     * Hash set, constant-time lookups at the highest memory cost.
+     */
+    Hash
+}
+
+/**
+ * A set of keys held in native memory, restricting searches to the keys in it.
+ * It is evaluated without leaving native code, so build it once, e.g. per tenant,
+ * and reuse it across searches.
+ * @param keys the allowed keys, or the denied ones if [exclude] is on.
+ * @param kind the data structure to keep the keys in.
+ * @param exclude when on, the filter admits every key except [keys].
+ */
+expect class KeyFilter(keys: ULongArray, kind: FilterKind = FilterKind.Bitset, exclude: Boolean = false)
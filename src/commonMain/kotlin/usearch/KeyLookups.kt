@@ -0,0 +1,24 @@
+package usearch
+
+/**
+ * How an [Index] maps keys to its vectors, see [IndexOptions.keyLookups].
+ */
+expect enum class KeyLookups {
+    /**
+     * Keep a hash table from keys to vectors, allowing any keys, as well as [Index.get], [Index.remove]
+     * and [Index.contains].
+     */
+    Hash,
+
+    /**
+     * Keep no table, saving its memory and the cost of updating it on every [Index.add].
+     * Keys only come back from searches, and everything finding a vector by its key throws.
+     */
+    None,
+
+    /**
+     * Keep no table, like [None], with keys promised to be `0, 1, 2, ...` in the order of insertion,
+     * which lets [Index.contains] answer from the size. The promise isn't checked.
+     */
+    Identity
+}
@@ -2,6 +2,12 @@ package usearch
 
 @OptIn(ExperimentalUnsignedTypes::class)
 expect class Matches : Iterable<Match> {
+    /**
+     * Views the first [size] entries of [keys] and [distances] without copying them,
+     * so the arrays must not be modified afterward.
+     */
+    constructor(keys: ULongArray, distances: FloatArray, size: Int)
+
     val keys: List<ULong>
     val distances: List<Float>
     override fun iterator(): Iterator<Match>
@@ -0,0 +1,37 @@
+package usearch
+
+/**
+ * Where the memory of an [Index] goes, in bytes, see [Index.memoryBreakdown].
+ */
+data class MemoryBreakdown(
+    /**
+     * Graph nodes, their headers and neighbor lists on every level.
+     */
+    val graph: ULong,
+
+    /**
+     * Vectors, after quantization.
+     */
+    val vectors: ULong,
+
+    /**
+     * Key to slot lookup table, estimated from [Index.capacity].
+     */
+    val lookup: ULong,
+
+    /**
+     * Memory of [Index.loadHugePages], holding the graph and the vectors of such indexes.
+     */
+    val hugePages: ULong,
+
+    /**
+     * Everything else: per-thread search contexts, per-slot bookkeeping and allocator slack.
+     */
+    val other: ULong,
+
+    /**
+     * Same as [Index.memoryUsage]. The graph and the vectors of a viewed index count towards it
+     * only when they are in [hugePages] rather than in a mapped file.
+     */
+    val total: ULong,
+)
@@ -0,0 +1,40 @@
+package usearch
+
+/**
+ * Reusable storage for search results. Searching into it doesn't allocate per query or per neighbor,
+ * which keeps steady-state search off the garbage collector.
+ * A buffer holds the results of one search at a time, so don't share it between threads.
+ * @param capacity number of neighbors to search for, the "k" in "kANN".
+ */
+expect class SearchBuffer(capacity: Int) {
+    val capacity: Int
+
+    /**
+     * Number of neighbors found by the last search into this buffer.
+     */
+    val size: Int
+
+    /**
+     * @return key of the [index]-th closest neighbor found by the last search.
+     * @throws IndexOutOfBoundsException if [index] is not below [size].
+     */
+    fun key(index: Int): ULong
+
+    /**
+     * @return distance to the [index]-th closest neighbor found by the last search.
+     * @throws IndexOutOfBoundsException if [index] is not below [size].
+     */
+    fun distance(index: Int): Float
+
+    /**
+     * Copies the results of the last search out of this buffer.
+     */
+    fun toMatches(): Matches
+}
+
+internal fun SearchBuffer.checkIndex(index: Int): Int {
+    if (index < 0 || index >= size) {
+        throw IndexOutOfBoundsException("index $index is out of bounds for size $size")
+    }
+    return index
+}
@@ -0,0 +1,75 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+/**
+ * Several independent indexes sharing the same [IndexOptions], each holding the keys routed to it by hash.
+ * Adds and searches reach all shards at once on native threads kept alive with this object,
+ * and the neighbors found in every shard are merged into one [Matches].
+ *
+ * Shards are persisted independently, so they can be rebuilt and swapped one at a time.
+ * Turn on [IndexOptions.threadSafe] to swap them while other threads are searching.
+ * @param options configuration of every shard.
+ * @param shards number of shards, at least one.
+ */
+expect class ShardedIndex(options: IndexOptions, shards: Int) {
+    /**
+     * Number of shards.
+     */
+    val shards: Int
+
+    /**
+     * Reports the total number of vectors across all shards.
+     */
+    val size: ULong
+
+    /**
+     * Adds a vector to the shard its key is routed to.
+     * @throws USearchException when [IndexOptions.multi] is off and key already exists.
+     */
+    fun add(key: ULong, vec: FloatArray)
+
+    /**
+     * Adds a batch of vectors in one native call, filling all shards in parallel.
+     * @param keys the keys associated with each row of [matrix].
+     * @param matrix the vectors to add, laid out row after row, one row per key.
+     */
+    fun addAll(keys: ULongArray, matrix: FloatArray)
+
+    /**
+     * Removes the vector associated with the given key from its shard.
+     */
+    fun remove(key: ULong)
+
+    /**
+     * Checks if any shard contains a vector with a specific key.
+     */
+    operator fun contains(key: ULong): Boolean
+
+    /**
+     * Searches every shard for the nearest neighbors of a query and merges them, closest first.
+     * @param query the query vector.
+     * @param count upper bound of result amount.
+     */
+    fun search(query: FloatArray, count: Int): Matches
+
+    /**
+     * Saves one shard to a file, like [Index.saveFile].
+     * @param shard zero-based number of the shard.
+     */
+    fun saveShard(shard: Int, filePath: String)
+
+    /**
+     * Replaces one shard with the index saved in a file, like [Index.loadFile].
+     * Its vectors must have been routed to this shard, i.e. saved from the same shard of an index with as many shards.
+     * @param shard zero-based number of the shard.
+     */
+    fun loadShard(shard: Int, filePath: String)
+
+    /**
+     * Replaces one shard with a memory-mapped view of a file, like [Index.viewFile].
+     * @param shard zero-based number of the shard.
+     * @see loadShard
+     */
+    fun viewShard(shard: Int, filePath: String, advice: ViewAdvice = ViewAdvice.Normal)
+}
@@ -0,0 +1,26 @@
+package usearch
+
+/**
+ * Full-precision copies of the vectors of a quantized [Index], which [Index.searchReranked]
+ * re-ranks the candidates of the graph against. Only the few candidates of every search are read,
+ * so the store can live on disk while the index keeps `f16` or `i8` vectors in memory.
+ */
+expect class VectorStore {
+    companion object {
+        /**
+         * Maps a matrix file into memory. The file is a raw row-major matrix in native byte order without any header,
+         * row `i` holding the vector of key `i`. Keys past the last row are treated as missing.
+         * @param filePath the path of the matrix.
+         * @param dimensions the number of scalars in every row, matching the index.
+         * @param kind the scalar type of the matrix, [ScalarKind.F32] or [ScalarKind.F64].
+         * @throws USearchException if the file can't be mapped or doesn't hold a whole number of rows.
+         */
+        fun mapFile(filePath: String, dimensions: ULong, kind: ScalarKind = ScalarKind.F32): VectorStore
+
+        /**
+         * Reads vectors through [fetch], called once per candidate on the thread of the search.
+         * @param fetch copies the vector of the key into the array and returns `true`, or returns `false` if it's missing.
+         */
+        fun fetching(fetch: (key: ULong, vector: FloatArray) -> Boolean): VectorStore
+    }
+}
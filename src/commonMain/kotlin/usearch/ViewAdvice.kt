@@ -0,0 +1,26 @@
+package usearch
+
+/**
+ * Access pattern hints for [Index.viewFile]. Ignored where the platform has no `madvise`.
+ */
+expect enum class ViewAdvice {
+    /**
+     * Leave the kernel defaults, with moderate read-ahead.
+     */
+    Normal,
+
+    /**
+     * Expect random access, disabling read-ahead, which suits graph traversal on a cold page cache.
+     */
+    Random,
+
+    /**
+     * Expect sequential access, with aggressive read-ahead.
+     */
+    Sequential,
+
+    /**
+     * Start reading the whole file in the background, so later faults are mostly served from the page cache.
+     */
+    WillNeed
+}
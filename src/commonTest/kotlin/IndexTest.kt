@@ -1,15 +1,37 @@
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.joinAll
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.runBlocking
+import usearch.Aggregation
+import usearch.AsyncIndex
+import usearch.CacheStats
+import usearch.FilterKind
 import usearch.Float16Array
 import usearch.Index
 import usearch.IndexOptions
+import usearch.KeyLookups
+import usearch.KeyFilter
 import usearch.MetricKind
 import usearch.ScalarKind
+import usearch.SearchBuffer
+import usearch.ShardedIndex
+import usearch.USearchException
+import usearch.VectorStore
+import usearch.distanceMatrix
+import usearch.distances
+import usearch.exactSearch
 import usearch.toFloat16
 import kotlin.math.E
 import kotlin.math.PI
+import kotlin.math.cos
+import kotlin.math.sin
 import kotlin.test.Test
 import kotlin.test.assertContentEquals
 import kotlin.test.assertEquals
 import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
 import kotlin.test.assertNull
 import kotlin.test.assertTrue
 
@@ -48,6 +70,353 @@ class IndexTest {
         assertContentEquals(ulongArrayOf(1u, 2u), matches.keys.sorted())
     }
 
+    @Test
+    fun searchTyped() {
+        val index = Index(exampleOpts)
+        index.asF16.add(1u, Float16Array(3) { (it + 1).toFloat16() })
+        index.asI8.add(2u, byteArrayOf(-3, 1, -2))
+        assertEquals(listOf(1uL), index.asF16.search(Float16Array(3) { (it + 1).toFloat16() }, 1).keys)
+        assertEquals(listOf(2uL), index.asI8.search(byteArrayOf(-3, 1, -2), 1).keys)
+        assertEquals(listOf(2uL), index.asF64.search(doubleArrayOf(-3.0, 1.0, -2.0), 1).keys)
+    }
+
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Test
+    fun addAll() {
+        val index = Index(exampleOpts)
+        val matrix = FloatArray(3 * 100) { (it % 7 + 1).toFloat() }
+        index.asF32.addAll(ULongArray(100) { it.toULong() }, matrix)
+        assertEquals(100u, index.size)
+        assertContentEquals(matrix.sliceArray(3 until 6), index.asF32[1u])
+        assertFailsWith(IllegalArgumentException::class) {
+            index.asF32.addAll(ulongArrayOf(100u, 101u), FloatArray(3))
+        }
+        assertFailsWith(IllegalArgumentException::class) {
+            index.asF32.addAll(ulongArrayOf(100u, 101u), FloatArray(4))
+        }
+    }
+
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Test
+    fun searchBatch() {
+        val index = Index(exampleOpts)
+        val a = floatArrayOf(1f, 2f, 3f)
+        val b = floatArrayOf(-3f, 1f, -2f)
+        index.asF32.add(1u, a)
+        index.asF32.add(2u, b)
+        val matches = index.searchBatch(a + b, 1)
+        assertEquals(2, matches.size)
+        assertContentEquals(ulongArrayOf(1u), matches[0].keys)
+        assertContentEquals(ulongArrayOf(2u), matches[1].keys)
+    }
+
+    @Test
+    fun searchWithin() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32))
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 1f, 1f))
+        }
+        val query = floatArrayOf(0f, 1f, 1f)
+        assertEquals((0uL..10uL).toList(), index.searchWithin(query, 100f).keys.toList())
+        // More matches than the first round asks for.
+        assertEquals((0uL..50uL).toList(), index.searchWithin(query, 2500f).keys.toList())
+        assertEquals((0uL..9uL).toList(), index.searchWithin(query, 2500f, maxResults = 10).keys.toList())
+        assertTrue(index.searchWithin(floatArrayOf(-10f, 1f, 1f), 50f).keys.isEmpty())
+        assertFailsWith(IllegalArgumentException::class) {
+            index.searchWithin(floatArrayOf(0f, 1f), 100f)
+        }
+
+        val batch = index.searchWithinBatch(query + floatArrayOf(99f, 1f, 1f), 4f)
+        assertEquals(listOf(0uL, 1uL, 2uL), batch[0].keys.toList())
+        assertEquals(listOf(99uL, 98uL, 97uL), batch[1].keys.toList())
+    }
+
+    @Test
+    fun searchGrouped() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32, multi = true))
+        // More vectors under the closest key than the first round asks for.
+        repeat(20) {
+            index.asF32.add(1u, floatArrayOf(it * 0.05f, 0f, 0f))
+        }
+        index.asF32.add(2u, floatArrayOf(1.5f, 0f, 0f))
+        index.asF32.add(3u, floatArrayOf(2f, 0f, 0f))
+        index.asF32.add(4u, floatArrayOf(0.3f, 0f, 0f))
+        val query = floatArrayOf(0f, 0f, 0f)
+
+        val closest = index.searchGrouped(query, 3)
+        assertEquals(listOf(1uL, 4uL, 2uL), closest.keys)
+        assertEquals(0f, closest.distances[0])
+        // The mean only sees the seven vectors of key 1 among the eight candidates of the first round.
+        assertEquals(listOf(1uL, 4uL), index.searchGrouped(query, 2, Aggregation.Mean).keys)
+        assertEquals(listOf(1uL, 4uL), index.searchGrouped(query, 2, Aggregation.TopSum, topM = 3).keys)
+        assertEquals(4, index.searchGrouped(query, 10).keys.size)
+    }
+
+    @Test
+    fun searchGroupedTopSum() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32, multi = true))
+        index.asF32.add(1u, floatArrayOf(0.1f, 0f, 0f))
+        repeat(3) {
+            index.asF32.add(2u, floatArrayOf(0.15f + it * 0.01f, 0f, 0f))
+        }
+        repeat(4) {
+            index.asF32.add(3u + it.toULong(), floatArrayOf(1f + it * 0.3f, 0f, 0f))
+        }
+        val query = floatArrayOf(0f, 0f, 0f)
+
+        assertEquals(listOf(1uL, 2uL), index.searchGrouped(query, 2).keys)
+        // The single vector of key 1 is closest, but the missing two count as far as the farthest candidate.
+        assertEquals(listOf(2uL, 1uL), index.searchGrouped(query, 2, Aggregation.TopSum, topM = 3).keys)
+        assertFailsWith<IllegalArgumentException> { index.searchGrouped(floatArrayOf(0f, 0f), 2) }
+    }
+
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Test
+    fun searchFiltered() {
+        val index = Index(exampleOpts)
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 1f, 1f))
+        }
+        val query = floatArrayOf(0f, 1f, 1f)
+        FilterKind.entries.forEach { kind ->
+            val allowed = KeyFilter(ulongArrayOf(42u, 7u, 99u), kind)
+            assertEquals(listOf(7uL, 42uL, 99uL), index.search(query, 10, allowed).keys.sorted())
+            val denied = KeyFilter(ULongArray(50) { it.toULong() }, kind, exclude = true)
+            assertTrue(index.asF32.search(query, 10, denied).keys.all { it >= 50u })
+        }
+    }
+
+    @Test
+    fun searchReranked() {
+        val vectors = List(200) { floatArrayOf(sin(it.toFloat()), cos(it.toFloat()), it / 200f - 0.5f) }
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.I8))
+        vectors.forEachIndexed { key, vector -> index.asF32.add(key.toULong(), vector) }
+        val store = VectorStore.fetching { key, vector ->
+            vectors[key.toInt()].copyInto(vector)
+            key % 2u == 0uL
+        }
+        val query = floatArrayOf(sin(42f) + 0.01f, cos(42f), 42 / 200f - 0.5f)
+        val matches = index.searchReranked(query, 5, store, oversample = 8)
+        assertEquals(42uL, matches.keys.first())
+        assertTrue(matches.keys.all { it % 2u == 0uL })
+        assertEquals(distances(query, vectors[42], MetricKind.L2sq).single(), matches.distances.first())
+        assertEquals(matches.distances.sorted(), matches.distances)
+        assertFailsWith(IllegalArgumentException::class) {
+            index.searchReranked(query, 5, store, oversample = 0)
+        }
+        assertFailsWith(IllegalArgumentException::class) {
+            index.searchReranked(floatArrayOf(1f, 2f), 5, store)
+        }
+    }
+
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Test
+    fun sharded() {
+        val index = ShardedIndex(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32), 4)
+        index.addAll(ULongArray(200) { it.toULong() }, FloatArray(3 * 200) { if (it % 3 == 0) it / 3f else 0f })
+        index.add(1000u, floatArrayOf(1000f, 0f, 0f))
+        assertEquals(201u, index.size)
+        val matches = index.search(floatArrayOf(100.2f, 0f, 0f), 3)
+        assertEquals(listOf(100uL, 101uL, 99uL), matches.keys)
+        assertEquals(matches.distances.sorted(), matches.distances)
+        assertTrue(1000uL in index)
+        index.remove(1000u)
+        assertTrue(1000uL !in index)
+        assertFailsWith(IllegalArgumentException::class) {
+            index.addAll(ulongArrayOf(2000u, 2001u), FloatArray(4))
+        }
+        assertFailsWith(IllegalArgumentException::class) {
+            index.add(2000u, floatArrayOf(1f, 0f))
+        }
+        assertFailsWith(IllegalArgumentException::class) {
+            index.search(floatArrayOf(1f, 0f), 3)
+        }
+        assertFailsWith(IndexOutOfBoundsException::class) {
+            index.saveShard(4, "shard.bin")
+        }
+    }
+
+    @Test
+    fun bruteForce() {
+        val dataset = floatArrayOf(1f, 0f, 0f, 0f, 1f, 0f, 0f, 0f, 1f)
+        val matches = exactSearch(dataset, floatArrayOf(0f, 0.9f, 0.1f), 3u, 2, MetricKind.L2sq).single()
+        assertEquals(listOf(1uL, 2uL), matches.keys)
+        assertTrue(exactSearch(FloatArray(0), floatArrayOf(0f, 0.9f, 0.1f), 3u, 2, MetricKind.L2sq).single().none())
+        assertTrue(exactSearch(dataset, FloatArray(0), 3u, 2, MetricKind.L2sq).isEmpty())
+    }
+
+    @Test
+    fun distances() {
+        val matrix = FloatArray(3 * 5000) { (it % 11).toFloat() }
+        val query = floatArrayOf(1f, 2f, 3f)
+        val expected = FloatArray(5000) { row ->
+            (0 until 3).sumOf { val d = matrix[row * 3 + it] - query[it]; (d * d).toDouble() }.toFloat()
+        }
+        assertContentEquals(expected, distances(query, matrix, MetricKind.L2sq))
+        assertContentEquals(expected, distances(query, matrix, MetricKind.L2sq, threads = 1u))
+
+        val queries = query + floatArrayOf(0f, 0f, 0f)
+        val cross = distanceMatrix(queries, matrix, 3u, MetricKind.L2sq)
+        assertEquals(2 * 5000, cross.size)
+        assertContentEquals(expected, cross.copyOfRange(0, 5000))
+        assertEquals(0f + 1f + 4f, cross[5000])
+        assertFailsWith(IllegalArgumentException::class) {
+            distanceMatrix(queries, FloatArray(4), 3u, MetricKind.L2sq)
+        }
+    }
+
+    @Test
+    fun growth() {
+        val index = Index(exampleOpts)
+        index.changeGrowthPolicy(1.5f, 16u)
+        repeat(1000) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 1f, 2f))
+        }
+        assertEquals(1000u, index.size)
+        assertTrue(index.capacity >= index.size)
+        assertFailsWith(USearchException::class) {
+            index.changeGrowthPolicy(0.5f, 16u)
+        }
+    }
+
+    @Test
+    fun compact() {
+        val index = Index(exampleOpts)
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 1f, 2f))
+        }
+        repeat(50) {
+            index.remove((it * 2).toULong())
+        }
+        assertEquals(50u, index.size)
+        assertEquals(50u, index.tombstones)
+        index.compact()
+        assertEquals(0u, index.tombstones)
+        assertEquals(50u, index.size)
+        assertTrue(1uL in index)
+        assertTrue(0uL !in index)
+        assertEquals(listOf(99uL), index.search(floatArrayOf(99f, 1f, 2f), 1).keys)
+    }
+
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Test
+    fun stats() {
+        val index = Index(exampleOpts)
+        index.asF32.add(0u, floatArrayOf(0f, 1f, 2f))
+        assertEquals(0u, index.stats.adds)
+
+        index.statsEnabled = true
+        repeat(20) {
+            index.asF32.add((it + 1).toULong(), floatArrayOf(it.toFloat(), 1f, 2f))
+        }
+        repeat(5) {
+            index.search(floatArrayOf(3f, 1f, 2f), 3)
+        }
+        index.search(floatArrayOf(3f, 1f, 2f), 3, KeyFilter(ulongArrayOf(1u)))
+        val stats = index.stats
+        assertEquals(20u, stats.adds)
+        assertEquals(6u, stats.searches)
+        assertTrue(stats.hops > 0u && stats.distances > 0u && stats.filtered > 0u)
+        assertEquals(stats.adds, stats.addLatency.total)
+        assertEquals(stats.searches, stats.searchLatency.total)
+        assertTrue(stats.searchLatency.percentile(0.5) <= stats.searchLatency.percentile(1.0))
+
+        index.statsEnabled = false
+        index.search(floatArrayOf(3f, 1f, 2f), 3)
+        assertEquals(6u, index.stats.searches)
+        index.resetStats()
+        assertEquals(0u, index.stats.searchLatency.total)
+    }
+
+    @Test
+    fun threadSafe() = runBlocking {
+        val index = Index(exampleOpts.copy(threadSafe = true))
+        val query = floatArrayOf(1f, 2f, 3f)
+        (0 until 4).map { worker ->
+            launch(Dispatchers.Default) {
+                repeat(250) {
+                    val key = (worker * 250 + it).toULong()
+                    index.asF32.add(key, floatArrayOf(key.toFloat(), 2f, 3f))
+                    index.search(query, 5)
+                    if (it % 50 == 0) {
+                        index.reserve(index.capacity + 16u)
+                        index.metricKind = if (worker % 2 == 0) MetricKind.L2sq else MetricKind.Cos
+                    }
+                }
+            }
+        }.joinAll()
+        assertEquals(1000u, index.size)
+    }
+
+    @Test
+    fun memoryBreakdown() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32))
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+        }
+        val breakdown = index.memoryBreakdown
+        assertEquals(100uL * 3uL * 4uL, breakdown.vectors)
+        assertTrue(breakdown.graph > 0u)
+        assertEquals(0uL, breakdown.hugePages)
+        assertEquals(index.memoryUsage, breakdown.total)
+    }
+
+    @Test
+    fun queryCache() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32))
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+        }
+        index.cacheCapacity = 16u
+        val query = floatArrayOf(42f, 0f, 0f)
+        val missed = index.search(query, 3)
+        val hit = index.search(query, 3)
+        assertEquals(missed.keys, hit.keys)
+        assertEquals(missed.distances, hit.distances)
+        assertEquals(CacheStats(hits = 1u, misses = 1u, entries = 1u), index.cacheStats)
+
+        // Any change makes the cached results stale.
+        index.asF32.add(100u, floatArrayOf(42f, 0f, 0f))
+        assertTrue(100uL in index.search(query, 3).keys)
+        assertEquals(2uL, index.cacheStats.misses)
+
+        index.cacheCapacity = 0u
+        assertEquals(CacheStats(0u, 0u, 0u), index.cacheStats)
+    }
+
+    @Test
+    fun identityKeys() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32, keyLookups = KeyLookups.Identity))
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+        }
+        assertEquals(42uL, index.search(floatArrayOf(42f, 0f, 0f), 1).keys[0])
+        assertTrue(99uL in index)
+        assertFalse(100uL in index)
+        assertEquals(0uL, index.memoryBreakdown.lookup)
+        assertFailsWith<USearchException> { index.remove(0u) }
+    }
+
+    @Test
+    fun asyncIndex() = runBlocking {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32))
+        val queued = AsyncIndex(index, depth = 8, batchSize = 4, threads = 2u)
+        // Far more requests than the queue holds, so that most of them wait for a slot.
+        (0 until 200).map { key ->
+            launch { queued.add(key.toULong(), floatArrayOf(key.toFloat(), 2f, 3f)) }
+        }.joinAll()
+        assertEquals(200u, index.size)
+        val found = (0 until 50).map { key ->
+            async { queued.search(floatArrayOf(key.toFloat(), 2f, 3f), 1) }
+        }.awaitAll()
+        found.forEachIndexed { key, matches -> assertEquals(listOf(key.toULong()), matches.keys) }
+        assertFailsWith<USearchException> { queued.add(0u, floatArrayOf(0f, 2f, 3f)) }
+        assertFailsWith<IllegalArgumentException> { queued.add(1000u, floatArrayOf(0f, 2f)) }
+        assertFailsWith<IllegalArgumentException> { queued.search(floatArrayOf(0f), 1) }
+        queued.close()
+        assertFailsWith<USearchException> { queued.search(floatArrayOf(0f, 2f, 3f), 1) }
+    }
+
     @Test
     fun contains() {
         (0 .. 10).forEach {
@@ -68,6 +437,30 @@ class IndexTest {
         assertEquals(index.size, load.size)
     }
 
+    @Test
+    fun saveStream() {
+        val index = exampleIndex
+        val chunks = mutableListOf<ByteArray>()
+        index.saveStream(bufferSize = 7) { buffer, length -> chunks.add(buffer.copyOf(length)) }
+        val serialized = chunks.reduce(ByteArray::plus)
+        assertEquals(index.serializedLength, serialized.size.toULong())
+
+        val load = Index(exampleOpts)
+        var position = 0
+        load.loadStream(bufferSize = 5) { buffer, length ->
+            val read = minOf(length, serialized.size - position)
+            serialized.copyInto(buffer, 0, position, position + read)
+            position += read
+            read
+        }
+        assertEquals(index.size, load.size)
+        assertEquals(serialized.size, position)
+
+        assertFailsWith(USearchException::class) {
+            Index(exampleOpts).loadStream { _, _ -> 0 }
+        }
+    }
+
     @Test
     fun saveEmptyBuffer() {
         val index = exampleIndex
@@ -77,6 +470,24 @@ class IndexTest {
         }
     }
 
+    @Test
+    fun searchBuffer() {
+        val index = exampleIndex
+        val buffer = SearchBuffer(4)
+        repeat(3) {
+            assertEquals(4, index.search(floatArrayOf(3.7f, 4.9f, -36f), buffer))
+        }
+        assertEquals(buffer.toMatches().keys, List(4) { buffer.key(it) })
+        assertFailsWith(IndexOutOfBoundsException::class) {
+            buffer.distance(4)
+        }
+        val single = Index(exampleOpts)
+        single.asF32.add(7u, floatArrayOf(1f, 2f, 3f))
+        assertEquals(1, single.asF32.search(floatArrayOf(1f, 2f, 3f), buffer))
+        assertEquals(1, buffer.size)
+        assertEquals(7uL, buffer.key(0))
+    }
+
     @Test
     fun indexOutOfBounds() {
         val index = Index(exampleOpts)
@@ -101,6 +512,21 @@ class IndexTest {
         assertNull(index.asF32[1u])
     }
 
+    @OptIn(ExperimentalUnsignedTypes::class)
+    @Test
+    fun getAll() {
+        val index = Index(exampleOpts)
+        val matrix = FloatArray(3 * 2000) { it.toFloat() }
+        index.asF32.addAll(ULongArray(2000) { it.toULong() }, matrix)
+        assertContentEquals(
+            matrix.sliceArray(3 until 6) + FloatArray(3) + matrix.sliceArray(0 until 3),
+            index.asF32.getAll(ulongArrayOf(1u, 5000u, 0u))
+        )
+        assertContentEquals(matrix, index.asF32.getAll(ULongArray(2000) { it.toULong() }))
+        assertContentEquals(index.asI8[7u], index.asI8.getAll(ulongArrayOf(7u)))
+        assertEquals(0, index.asF64.getAll(ULongArray(0)).size)
+    }
+
     @Test
     fun addF16() {
         val index = Index(exampleOpts)
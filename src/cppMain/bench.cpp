@@ -0,0 +1,281 @@
+#include "lib.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Measures the C API the bindings are built on:
+// add throughput, search QPS, single-query latency percentiles and recall@k against exact search.
+// Every benchmark takes the dimensions, the quantization and the number of threads as arguments.
+
+namespace {
+constexpr size_t dataset_size = 10000;
+constexpr size_t queries_size = 1000;
+constexpr size_t k = 10;
+
+// Binary vectors are generated as packed bits and compared with Hamming distance,
+// everything else starts as `f32` and is compared with cosine similarity.
+struct dataset_t {
+    usearch_scalar_kind_t kind;
+    size_t dimensions;
+    size_t stride;
+    std::vector<char> vectors;
+    std::vector<char> queries;
+    std::vector<usearch_key_t> keys;
+    std::vector<usearch_key_t> truth;
+};
+
+struct index_deleter_t {
+    void operator()(void *index) const { usearch_free(index, nullptr); }
+};
+
+using index_ptr_t = std::unique_ptr<void, index_deleter_t>;
+
+usearch_scalar_kind_t input_kind(usearch_scalar_kind_t quantization) {
+    return quantization == usearch_scalar_b1_k ? usearch_scalar_b1_k : usearch_scalar_f32_k;
+}
+
+usearch_metric_kind_t metric_kind(usearch_scalar_kind_t quantization) {
+    return quantization == usearch_scalar_b1_k ? usearch_metric_hamming_k : usearch_metric_cos_k;
+}
+
+std::vector<char> random_matrix(size_t rows, size_t stride, usearch_scalar_kind_t kind, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::vector<char> matrix(rows * stride);
+    if (kind == usearch_scalar_b1_k) {
+        std::uniform_int_distribution<int> bits(0, 255);
+        for (auto &byte: matrix)
+            byte = static_cast<char>(bits(generator));
+    } else {
+        std::normal_distribution<float> scalars;
+        auto floats = reinterpret_cast<float *>(matrix.data());
+        for (size_t i = 0; i != matrix.size() / sizeof(float); ++i)
+            floats[i] = scalars(generator);
+    }
+    return matrix;
+}
+
+dataset_t const &dataset(size_t dimensions, usearch_scalar_kind_t quantization) {
+    static std::map<std::pair<size_t, usearch_scalar_kind_t>, std::unique_ptr<dataset_t> > cache;
+    auto &cached = cache[std::make_pair(dimensions, input_kind(quantization))];
+    if (cached)
+        return *cached;
+
+    cached.reset(new dataset_t());
+    dataset_t &data = *cached;
+    data.kind = input_kind(quantization);
+    data.dimensions = dimensions;
+    data.stride = data.kind == usearch_scalar_b1_k ? (dimensions + 7) / 8 : dimensions * sizeof(float);
+    data.vectors = random_matrix(dataset_size, data.stride, data.kind, 42);
+    data.queries = random_matrix(queries_size, data.stride, data.kind, 43);
+    data.keys.resize(dataset_size);
+    for (size_t i = 0; i != dataset_size; ++i)
+        data.keys[i] = i;
+
+    // Rows are numbered like the keys, so the exact neighbors are directly comparable with the approximate ones.
+    data.truth.resize(queries_size * k);
+    std::vector<usearch_distance_t> distances(queries_size * k);
+    usearch_error_t err = nullptr;
+    usearch_exact_search(data.vectors.data(), dataset_size, data.stride, data.queries.data(), queries_size,
+                         data.stride, data.kind, dimensions, metric_kind(quantization), k, 0,
+                         data.truth.data(), k * sizeof(usearch_key_t), distances.data(), k * sizeof(float), &err);
+    if (err)
+        data.truth.clear();
+    return data;
+}
+
+index_ptr_t make_index(size_t dimensions, usearch_scalar_kind_t quantization, usearch_error_t *err) {
+    usearch_init_options_t opts{};
+    opts.metric_kind = metric_kind(quantization);
+    opts.quantization = quantization;
+    opts.dimensions = dimensions;
+    index_ptr_t index(usearch_init(&opts, err));
+    if (!*err)
+        usearch_reserve(index.get(), dataset_size, err);
+    return index;
+}
+
+index_ptr_t const &filled_index(size_t dimensions, usearch_scalar_kind_t quantization, usearch_error_t *err) {
+    static std::map<std::pair<size_t, usearch_scalar_kind_t>, index_ptr_t> cache;
+    auto &cached = cache[std::make_pair(dimensions, quantization)];
+    if (cached)
+        return cached;
+
+    dataset_t const &data = dataset(dimensions, quantization);
+    cached = make_index(dimensions, quantization, err);
+    if (!*err)
+        usearch_add_batch(cached.get(), data.keys.data(), data.vectors.data(), dataset_size, data.stride, data.kind,
+                          0, err);
+    if (*err)
+        cached.reset();
+    return cached;
+}
+
+double recall(dataset_t const &data, std::vector<usearch_key_t> const &found, std::vector<size_t> const &counts) {
+    if (data.truth.empty())
+        return 0;
+    size_t hits = 0;
+    for (size_t query = 0; query != queries_size; ++query) {
+        auto truth_begin = data.truth.begin() + query * k;
+        auto found_begin = found.begin() + query * k;
+        for (size_t i = 0; i != counts[query]; ++i)
+            hits += std::find(truth_begin, truth_begin + k, found_begin[i]) != truth_begin + k;
+    }
+    return static_cast<double>(hits) / (queries_size * k);
+}
+
+void add(benchmark::State &state) {
+    auto const dimensions = static_cast<size_t>(state.range(0));
+    auto const quantization = static_cast<usearch_scalar_kind_t>(state.range(1));
+    auto const threads = static_cast<size_t>(state.range(2));
+    dataset_t const &data = dataset(dimensions, quantization);
+
+    for (auto _: state) {
+        state.PauseTiming();
+        usearch_error_t err = nullptr;
+        index_ptr_t index = make_index(dimensions, quantization, &err);
+        state.ResumeTiming();
+        if (!err)
+            usearch_add_batch(index.get(), data.keys.data(), data.vectors.data(), dataset_size, data.stride,
+                              data.kind, threads, &err);
+        state.PauseTiming();
+        index.reset();
+        state.ResumeTiming();
+        if (err) {
+            state.SkipWithError(err);
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * dataset_size));
+}
+
+void search(benchmark::State &state) {
+    auto const dimensions = static_cast<size_t>(state.range(0));
+    auto const quantization = static_cast<usearch_scalar_kind_t>(state.range(1));
+    auto const threads = static_cast<size_t>(state.range(2));
+    dataset_t const &data = dataset(dimensions, quantization);
+    usearch_error_t err = nullptr;
+    index_ptr_t const &index = filled_index(dimensions, quantization, &err);
+    if (err) {
+        state.SkipWithError(err);
+        return;
+    }
+
+    std::vector<usearch_key_t> found(queries_size * k);
+    std::vector<usearch_distance_t> distances(queries_size * k);
+    std::vector<size_t> counts(queries_size);
+    for (auto _: state) {
+        usearch_search_batch(index.get(), data.queries.data(), data.kind, queries_size, data.stride, k, threads,
+                             found.data(), k * sizeof(usearch_key_t), distances.data(), k * sizeof(float),
+                             counts.data(), &err);
+        if (err) {
+            state.SkipWithError(err);
+            break;
+        }
+    }
+    // Items per second are the queries per second.
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries_size));
+    state.counters["recall@10"] = recall(data, found, counts);
+}
+
+void measure_latency(benchmark::State &state, void *index, dataset_t const &data) {
+    usearch_error_t err = nullptr;
+    std::vector<double> micros;
+    usearch_key_t found[k];
+    usearch_distance_t distances[k];
+    size_t query = 0;
+    for (auto _: state) {
+        auto const start = std::chrono::steady_clock::now();
+        usearch_search(index, data.queries.data() + query * data.stride, data.kind, k, found, distances, &err);
+        auto const end = std::chrono::steady_clock::now();
+        micros.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        query = (query + 1) % queries_size;
+        if (err) {
+            state.SkipWithError(err);
+            break;
+        }
+    }
+    if (micros.empty())
+        return;
+    std::sort(micros.begin(), micros.end());
+    state.counters["p50_us"] = micros[micros.size() / 2];
+    state.counters["p99_us"] = micros[micros.size() * 99 / 100];
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+void latency(benchmark::State &state) {
+    auto const dimensions = static_cast<size_t>(state.range(0));
+    auto const quantization = static_cast<usearch_scalar_kind_t>(state.range(1));
+    dataset_t const &data = dataset(dimensions, quantization);
+    usearch_error_t err = nullptr;
+    index_ptr_t const &index = filled_index(dimensions, quantization, &err);
+    if (err) {
+        state.SkipWithError(err);
+        return;
+    }
+    measure_latency(state, index.get(), data);
+}
+
+// Same as `latency`, with the index saved and loaded back either regularly or into huge pages.
+// The gap grows with the index, so raise `dataset_size` to see it on machines with large TLBs.
+void latency_huge_pages(benchmark::State &state) {
+    auto const dimensions = static_cast<size_t>(state.range(0));
+    auto const huge_pages = state.range(1) != 0;
+    dataset_t const &data = dataset(dimensions, usearch_scalar_f32_k);
+    usearch_error_t err = nullptr;
+    index_ptr_t const &filled = filled_index(dimensions, usearch_scalar_f32_k, &err);
+    if (err) {
+        state.SkipWithError(err);
+        return;
+    }
+
+    char const *path = "ksearch_bench_huge_pages.usearch";
+    usearch_save(filled.get(), path, &err);
+    index_ptr_t index = make_index(dimensions, usearch_scalar_f32_k, &err);
+    if (!err) {
+        if (huge_pages)
+            usearch_load_huge_pages(index.get(), path, &err);
+        else
+            usearch_load(index.get(), path, &err);
+    }
+    std::remove(path);
+    if (err) {
+        state.SkipWithError(err);
+        return;
+    }
+    measure_latency(state, index.get(), data);
+}
+
+void quantizations_and_threads(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t dimensions: {128, 1024})
+        for (int64_t quantization: {usearch_scalar_f32_k, usearch_scalar_f16_k, usearch_scalar_i8_k,
+                                    usearch_scalar_b1_k})
+            for (int64_t threads: {1, 4, 0})
+                benchmark->Args({dimensions, quantization, threads});
+    benchmark->ArgNames({"dims", "kind", "threads"})->UseRealTime();
+}
+
+void quantizations(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t dimensions: {128, 1024})
+        for (int64_t quantization: {usearch_scalar_f32_k, usearch_scalar_f16_k, usearch_scalar_i8_k,
+                                    usearch_scalar_b1_k})
+            benchmark->Args({dimensions, quantization});
+    benchmark->ArgNames({"dims", "kind"});
+}
+} // namespace
+
+BENCHMARK(add)->Apply(quantizations_and_threads)->Unit(benchmark::kMillisecond);
+BENCHMARK(search)->Apply(quantizations_and_threads)->Unit(benchmark::kMillisecond);
+BENCHMARK(latency)->Apply(quantizations)->Unit(benchmark::kMicrosecond);
+BENCHMARK(latency_huge_pages)
+    ->ArgsProduct({{128, 1024}, {0, 1}})
+    ->ArgNames({"dims", "huge_pages"})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -1,4 +1,6 @@
+#include <cstdint>
 #include <iostream>
+#include <vector>
 #include <usearch/index_dense.hpp>
 
 #include "jexceptions.h"
@@ -10,6 +12,101 @@ extern "C" {
 
 using search_result_t = unum::usearch::index_dense_gt<>::search_result_t;
 
+size_t bytes_per_vector(const usearch_scalar_kind_t kind, const size_t dimensions) {
+    switch (kind) {
+        case usearch_scalar_f64_k: return dimensions * sizeof(jdouble);
+        case usearch_scalar_f32_k: return dimensions * sizeof(jfloat);
+        case usearch_scalar_f16_k: return dimensions * sizeof(jshort);
+        case usearch_scalar_i8_k: return dimensions;
+        case usearch_scalar_b1_k: return (dimensions + 7) / 8;
+        default: return 0;
+    }
+}
+
+// Size of one element of the Java array carrying vectors of `kind`; bit vectors travel packed in a `byte[]`.
+size_t array_element_bytes(const usearch_scalar_kind_t kind) {
+    return kind == usearch_scalar_b1_k ? 1 : bytes_per_vector(kind, 1);
+}
+
+// Returns the bytes of one vector of `kind` in the index, or 0 with a pending exception.
+size_t index_vector_bytes(JNIEnv *env, const usearch_index_t index, const usearch_scalar_kind_t kind) {
+    usearch_error_t err = nullptr;
+    const auto dimensions = usearch_dimensions(index, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    const auto bytes = bytes_per_vector(kind, dimensions);
+    if (bytes == 0) {
+        throw_illegal_argument(env, "Unsupported scalar kind");
+    }
+    return bytes;
+}
+
+// Checks that `matrix` holds exactly `count` vectors of the index, returning the stride of its rows in bytes,
+// or 0 with a pending IllegalArgumentException.
+size_t matrix_stride(JNIEnv *env, const usearch_index_t index, const jarray matrix, const size_t count,
+                     const usearch_scalar_kind_t kind) {
+    const auto stride = index_vector_bytes(env, index, kind);
+    if (stride == 0) {
+        return 0;
+    }
+    const auto bytes = static_cast<size_t>(env->GetArrayLength(matrix)) * array_element_bytes(kind);
+    if (bytes != count * stride) {
+        throw_illegal_argument(env, "Matrix size doesn't match the number of keys times the index dimensions");
+        return 0;
+    }
+    return stride;
+}
+
+// Checks that the outputs of a batch search have room for `width` matches of each of `rows` queries and for one
+// count per query, returning false with a pending IllegalArgumentException otherwise.
+bool batch_outputs_fit(JNIEnv *env, const jarray keys, const jarray distances, const jarray counts, const size_t rows,
+                       const size_t width) {
+    if (static_cast<size_t>(env->GetArrayLength(keys)) < rows * width ||
+        static_cast<size_t>(env->GetArrayLength(distances)) < rows * width ||
+        static_cast<size_t>(env->GetArrayLength(counts)) < rows) {
+        throw_illegal_argument(env, "Output arrays are too short for the number of queries");
+        return false;
+    }
+    return true;
+}
+
+// Copies the first vector of a Java array out with `Get<Type>ArrayRegion`, so that the array is never pinned while
+// the index may block on its lock or allocate. Returns false with a pending exception if the array is too short.
+bool copy_vector(JNIEnv *env, const usearch_index_t index, const jarray array, const usearch_scalar_kind_t kind,
+                 std::vector<std::uint64_t> &vector) {
+    const auto bytes = index_vector_bytes(env, index, kind);
+    if (bytes == 0) {
+        return false;
+    }
+    const auto length = static_cast<jsize>(bytes / array_element_bytes(kind));
+    if (env->GetArrayLength(array) < length) {
+        throw_illegal_argument(env, "Array has fewer scalars than the index dimensions");
+        return false;
+    }
+    vector.resize((bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+    switch (kind) {
+        case usearch_scalar_f64_k:
+            env->GetDoubleArrayRegion(static_cast<jdoubleArray>(array), 0, length,
+                                      reinterpret_cast<jdouble *>(vector.data()));
+            break;
+        case usearch_scalar_f32_k:
+            env->GetFloatArrayRegion(static_cast<jfloatArray>(array), 0, length,
+                                     reinterpret_cast<jfloat *>(vector.data()));
+            break;
+        case usearch_scalar_f16_k:
+            env->GetShortArrayRegion(static_cast<jshortArray>(array), 0, length,
+                                     reinterpret_cast<jshort *>(vector.data()));
+            break;
+        default:
+            env->GetByteArrayRegion(static_cast<jbyteArray>(array), 0, length,
+                                    reinterpret_cast<jbyte *>(vector.data()));
+            break;
+    }
+    return true;
+}
+
 template<typename T, typename ArrayConstructor, typename Region>
 jobjectArray jarray_usearch_get(const char *type_name, ArrayConstructor new_array, Region set_array_region, JNIEnv *env,
                                 const jlong ptr,
@@ -23,28 +120,233 @@ jobjectArray jarray_usearch_get(const char *type_name, ArrayConstructor new_arra
         return nullptr;
     }
 
-    const auto buf = new T[count * dim];
-    const auto actual_count = usearch_get(p, key, count, buf, vector_kind, &err);
+    std::vector<T> buf(count * dim);
+    const auto actual_count = usearch_get(p, key, count, buf.data(), vector_kind, &err);
     if (err) {
         throw_usearch_exception(env, err);
         return nullptr;
     }
 
-    const auto array = env->NewObjectArray(static_cast<jsize>(actual_count), env->FindClass(type_name), nullptr);
-    for (auto i = 0; i < actual_count; ++i) {
+    // Array classes are never unloaded, so the lookup is done once per element type.
+    static const auto array_class = static_cast<jclass>(env->NewGlobalRef(env->FindClass(type_name)));
+    const auto array = env->NewObjectArray(static_cast<jsize>(actual_count), array_class, nullptr);
+    for (size_t i = 0; i < actual_count; ++i) {
         const auto vec = new_array(env, static_cast<jsize>(dim));
-        set_array_region(env, vec, 0, static_cast<jsize>(dim), buf + i * dim);
-        env->SetObjectArrayElement(array, i, vec);
+        set_array_region(env, vec, 0, static_cast<jsize>(dim), buf.data() + i * dim);
+        env->SetObjectArrayElement(array, static_cast<jsize>(i), vec);
+        env->DeleteLocalRef(vec);
     }
-
-    delete[] buf;
     return array;
 }
 
+template<typename Array, typename Elements, typename ReleaseElements>
+void jarray_usearch_add_batch(Elements get_elements, ReleaseElements release_elements, JNIEnv *env,
+                              const jlong ptr, const jlongArray keys, const Array matrix, const jlong threads,
+                              const usearch_scalar_kind_t vector_kind) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    const auto count = static_cast<size_t>(env->GetArrayLength(keys));
+    if (count == 0) {
+        return;
+    }
+    const auto stride = matrix_stride(env, p, matrix, count, vector_kind);
+    if (stride == 0) {
+        return;
+    }
+    const auto keys_arr = env->GetLongArrayElements(keys, nullptr);
+    const auto matrix_arr = get_elements(env, matrix);
+    usearch_error_t err = nullptr;
+    usearch_add_batch(p, reinterpret_cast<usearch_key_t *>(keys_arr), matrix_arr, count, stride, vector_kind,
+                      static_cast<size_t>(threads), &err);
+    release_elements(env, matrix, matrix_arr);
+    env->ReleaseLongArrayElements(keys, keys_arr, JNI_ABORT);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+// Copies the vector out before inserting it, as the insertion may grow the index or wait for its lock.
+void copied_usearch_add(JNIEnv *env, const jlong ptr, const jlong key, const jarray vec,
+                        const usearch_scalar_kind_t vector_kind) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, p, vec, vector_kind, vector)) {
+        return;
+    }
+    usearch_error_t err = nullptr;
+    usearch_add(p, key, vector.data(), vector_kind, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+// Searches into native buffers and copies the matches out, so that no array stays pinned during the search.
+jlong copied_usearch_search(JNIEnv *env, const jlong ptr, const void *query, const usearch_scalar_kind_t query_kind,
+                            const jint count, const jlongArray keys, const jfloatArray distances) {
+    std::vector<usearch_key_t> found_keys(static_cast<size_t>(count));
+    std::vector<usearch_distance_t> found_distances(static_cast<size_t>(count));
+    usearch_error_t err = nullptr;
+    const auto size = usearch_search(reinterpret_cast<usearch_index_t *>(ptr), query, query_kind,
+                                     static_cast<size_t>(count), found_keys.data(), found_distances.data(), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    env->SetLongArrayRegion(keys, 0, static_cast<jsize>(size), reinterpret_cast<const jlong *>(found_keys.data()));
+    env->SetFloatArrayRegion(distances, 0, static_cast<jsize>(size), found_distances.data());
+    return static_cast<jlong>(size);
+}
+
+jlong jarray_usearch_search(JNIEnv *env, const jlong ptr, const jarray query, const usearch_scalar_kind_t query_kind,
+                            const jint count, const jlongArray keys, const jfloatArray distances) {
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, reinterpret_cast<usearch_index_t *>(ptr), query, query_kind, vector)) {
+        return 0;
+    }
+    return copied_usearch_search(env, ptr, vector.data(), query_kind, count, keys, distances);
+}
+
+jlong jarray_usearch_search_filter(JNIEnv *env, const jlong ptr, const jarray query,
+                                   const usearch_scalar_kind_t query_kind, const jint count, const jlong filter,
+                                   const jlongArray keys, const jfloatArray distances) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, p, query, query_kind, vector)) {
+        return 0;
+    }
+    std::vector<usearch_key_t> found_keys(static_cast<size_t>(count));
+    std::vector<usearch_distance_t> found_distances(static_cast<size_t>(count));
+    usearch_error_t err = nullptr;
+    const auto size = usearch_search_filter(p, vector.data(), query_kind, static_cast<size_t>(count),
+                                            reinterpret_cast<usearch_filter_t>(filter), found_keys.data(),
+                                            found_distances.data(), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    env->SetLongArrayRegion(keys, 0, static_cast<jsize>(size), reinterpret_cast<const jlong *>(found_keys.data()));
+    env->SetFloatArrayRegion(distances, 0, static_cast<jsize>(size), found_distances.data());
+    return static_cast<jlong>(size);
+}
+
+// Shuttles bytes between native code and a `usearch.StreamCallback` through one reusable `byte[]`.
+struct jvm_stream_t {
+    JNIEnv *env;
+    jobject callback;
+    jmethodID transfer;
+    jbyteArray buffer;
+    jsize capacity;
+};
+
+bool jvm_stream_init(JNIEnv *env, jobject callback, jbyteArray buffer, jvm_stream_t &stream) {
+    stream.env = env;
+    stream.callback = callback;
+    stream.transfer = env->GetMethodID(env->GetObjectClass(callback), "transfer", "([BI)I");
+    stream.buffer = buffer;
+    stream.capacity = env->GetArrayLength(buffer);
+    if (!stream.transfer) {
+        return false;
+    }
+    if (stream.capacity <= 0) {
+        throw_illegal_argument(env, "Stream buffer is empty");
+        return false;
+    }
+    return true;
+}
+
+bool jvm_stream_write(void const *data, size_t length, void *state) {
+    const auto &stream = *static_cast<jvm_stream_t *>(state);
+    auto bytes = static_cast<const jbyte *>(data);
+    while (length) {
+        const auto chunk = length < static_cast<size_t>(stream.capacity) ? static_cast<jsize>(length) : stream.capacity;
+        stream.env->SetByteArrayRegion(stream.buffer, 0, chunk, bytes);
+        stream.env->CallIntMethod(stream.callback, stream.transfer, stream.buffer, chunk);
+        if (stream.env->ExceptionCheck()) {
+            return false;
+        }
+        bytes += chunk;
+        length -= chunk;
+    }
+    return true;
+}
+
+bool jvm_stream_read(void *data, size_t length, void *state) {
+    const auto &stream = *static_cast<jvm_stream_t *>(state);
+    auto bytes = static_cast<jbyte *>(data);
+    while (length) {
+        const auto chunk = length < static_cast<size_t>(stream.capacity) ? static_cast<jsize>(length) : stream.capacity;
+        const auto read = stream.env->CallIntMethod(stream.callback, stream.transfer, stream.buffer, chunk);
+        if (stream.env->ExceptionCheck() || read <= 0 || read > chunk) {
+            return false;
+        }
+        stream.env->GetByteArrayRegion(stream.buffer, 0, read, bytes);
+        bytes += read;
+        length -= read;
+    }
+    return true;
+}
+
+// Resolves the address of a vector inside a direct NIO buffer, `offset` and `length` being in bytes.
+// Returns nullptr with a pending exception if the buffer is on-heap or too short for one vector.
+const void *direct_vector(JNIEnv *env, const jlong ptr, const jobject buffer, const jlong offset, const jlong length,
+                          const usearch_scalar_kind_t vector_kind) {
+    const auto address = static_cast<const char *>(env->GetDirectBufferAddress(buffer));
+    if (!address) {
+        throw_illegal_argument(env, "Buffer is not direct");
+        return nullptr;
+    }
+    const auto required = index_vector_bytes(env, reinterpret_cast<usearch_index_t *>(ptr), vector_kind);
+    if (required == 0) {
+        return nullptr;
+    }
+    if (length < 0 || static_cast<size_t>(length) < required) {
+        throw_illegal_argument(env, "Buffer has fewer remaining bytes than a vector");
+        return nullptr;
+    }
+    return address + offset;
+}
+
+// Exports the vectors of all keys into one flat matrix, pinned for the whole batch, so that no per-vector arrays
+// are allocated. Rows of missing keys are zeroed. Returns the number of keys found.
+jlong critical_usearch_get_batch(JNIEnv *env, const jlong ptr, const jlongArray keys, const jarray matrix,
+                                 const size_t scalar_size, const jlong threads,
+                                 const usearch_scalar_kind_t vector_kind) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    const auto count = static_cast<size_t>(env->GetArrayLength(keys));
+    if (count == 0) {
+        return 0;
+    }
+    usearch_error_t err = nullptr;
+    const auto dimensions = usearch_dimensions(p, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    const auto stride = bytes_per_vector(vector_kind, dimensions);
+    if (stride == 0) {
+        throw_illegal_argument(env, "Unsupported scalar kind");
+        return 0;
+    }
+    if (static_cast<size_t>(env->GetArrayLength(matrix)) * scalar_size < count * stride) {
+        throw_illegal_argument(env, "Matrix is too small for the requested vectors");
+        return 0;
+    }
+
+    const auto keys_arr = env->GetPrimitiveArrayCritical(keys, nullptr);
+    const auto matrix_arr = env->GetPrimitiveArrayCritical(matrix, nullptr);
+    const auto found = usearch_get_batch(p, static_cast<usearch_key_t *>(keys_arr), count, matrix_arr, stride,
+                                         vector_kind, static_cast<size_t>(threads), &err);
+    env->ReleasePrimitiveArrayCritical(matrix, matrix_arr, 0);
+    env->ReleasePrimitiveArrayCritical(keys, keys_arr, JNI_ABORT);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    return static_cast<jlong>(found);
+}
+
 extern "C" {
 JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1new_1index_1opts(
     JNIEnv *, jobject, jlong dimensions, jint metric_k, jint quantization_k, jlong connectivity, jlong expansion_add,
-    jlong expansion_search, jboolean multi) {
+    jlong expansion_search, jboolean multi, jboolean thread_safe, jint key_lookups) {
     // ReSharper disable once CppDFAMemoryLeak
     auto r = new usearch_init_options_t{
         .metric_kind = static_cast<usearch_metric_kind_t>(metric_k),
@@ -53,7 +355,9 @@ JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1new_1index_1opts(
         .connectivity = static_cast<size_t>(connectivity),
         .expansion_add = static_cast<size_t>(expansion_add),
         .expansion_search = static_cast<size_t>(expansion_search),
-        .multi = multi == 1
+        .multi = multi == 1,
+        .thread_safe = thread_safe == 1,
+        .key_lookups = static_cast<usearch_key_lookups_t>(key_lookups)
     };
     return reinterpret_cast<jlong>(r);
 }
@@ -200,13 +504,7 @@ JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1remove
 
 JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1f32
 (JNIEnv *env, jobject, jlong ptr, jlong key, jfloatArray vec) {
-    const auto p = reinterpret_cast<unum::usearch::index_dense_t *>(ptr);
-    const auto arr = env->GetFloatArrayElements(vec, nullptr);
-    auto result = p->add(key, arr);
-    env->ReleaseFloatArrayElements(vec, arr, JNI_OK);
-    if (!result) {
-        throw_usearch_exception(env, result.error.release());
-    }
+    copied_usearch_add(env, ptr, key, vec, usearch_scalar_f32_k);
 }
 
 JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1f32
@@ -221,13 +519,7 @@ JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1f32
 
 void JNICALL Java_usearch_NativeBridge_usearch_1add_1f64
 (JNIEnv *env, jobject, jlong ptr, jlong key, jdoubleArray vec) {
-    const auto p = reinterpret_cast<unum::usearch::index_dense_t *>(ptr);
-    const auto arr = env->GetDoubleArrayElements(vec, nullptr);
-    auto result = p->add(key, arr);
-    env->ReleaseDoubleArrayElements(vec, arr, JNI_OK);
-    if (!result) {
-        throw_usearch_exception(env, result.error.release());
-    }
+    copied_usearch_add(env, ptr, key, vec, usearch_scalar_f64_k);
 }
 
 JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1f64
@@ -243,14 +535,7 @@ JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1f64
 
 JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1f16
 (JNIEnv *env, jobject, jlong ptr, jlong key, jshortArray vec) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
-    const auto arr = env->GetShortArrayElements(vec, nullptr);
-    usearch_error_t err = nullptr;
-    usearch_add(p, key, arr, usearch_scalar_f16_k, &err);
-    env->ReleaseShortArrayElements(vec, arr, JNI_OK);
-    if (err) {
-        throw_usearch_exception(env, err);
-    }
+    copied_usearch_add(env, ptr, key, vec, usearch_scalar_f16_k);
 }
 
 JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1f16
@@ -266,14 +551,7 @@ JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1f16
 
 JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1i8
 (JNIEnv *env, jobject, jlong ptr, jlong key, jbyteArray vec) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
-    const auto arr = env->GetByteArrayElements(vec, nullptr);
-    usearch_error_t err = nullptr;
-    usearch_add(p, key, arr, usearch_scalar_i8_k, &err);
-    env->ReleaseByteArrayElements(vec, arr, JNI_OK);
-    if (err) {
-        throw_usearch_exception(env, err);
-    }
+    copied_usearch_add(env, ptr, key, vec, usearch_scalar_i8_k);
 }
 
 JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1i8
@@ -283,20 +561,13 @@ JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1i8
         [](JNIEnv *env, jbyteArray arr, jsize start, jsize length, jbyte *source) {
             env->SetByteArrayRegion(arr, start, length, source);
         },
-        env, ptr, key, count, usearch_scalar_f16_k
+        env, ptr, key, count, usearch_scalar_i8_k
     );
 }
 
 JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1b1
 (JNIEnv *env, jobject, jlong ptr, jlong key, jbyteArray vec) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
-    const auto arr = env->GetByteArrayElements(vec, nullptr);
-    usearch_error_t err = nullptr;
-    usearch_add(p, key, arr, usearch_scalar_b1_k, &err);
-    env->ReleaseByteArrayElements(vec, arr, JNI_OK);
-    if (err) {
-        throw_usearch_exception(env, err);
-    }
+    copied_usearch_add(env, ptr, key, vec, usearch_scalar_b1_k);
 }
 
 JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1b1
@@ -310,119 +581,1138 @@ JNIEXPORT jobjectArray JNICALL Java_usearch_NativeBridge_usearch_1get_1b1
     );
 }
 
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1batch_1f32
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jfloatArray matrix, jlong threads) {
+    jarray_usearch_add_batch(
+        [](JNIEnv *env, jfloatArray arr) { return env->GetFloatArrayElements(arr, nullptr); },
+        [](JNIEnv *env, jfloatArray arr, jfloat *elements) { env->ReleaseFloatArrayElements(arr, elements, JNI_ABORT); },
+        env, ptr, keys, matrix, threads, usearch_scalar_f32_k);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1batch_1f64
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jdoubleArray matrix, jlong threads) {
+    jarray_usearch_add_batch(
+        [](JNIEnv *env, jdoubleArray arr) { return env->GetDoubleArrayElements(arr, nullptr); },
+        [](JNIEnv *env, jdoubleArray arr, jdouble *elements) {
+            env->ReleaseDoubleArrayElements(arr, elements, JNI_ABORT);
+        },
+        env, ptr, keys, matrix, threads, usearch_scalar_f64_k);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1batch_1f16
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jshortArray matrix, jlong threads) {
+    jarray_usearch_add_batch(
+        [](JNIEnv *env, jshortArray arr) { return env->GetShortArrayElements(arr, nullptr); },
+        [](JNIEnv *env, jshortArray arr, jshort *elements) { env->ReleaseShortArrayElements(arr, elements, JNI_ABORT); },
+        env, ptr, keys, matrix, threads, usearch_scalar_f16_k);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1batch_1i8
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jbyteArray matrix, jlong threads) {
+    jarray_usearch_add_batch(
+        [](JNIEnv *env, jbyteArray arr) { return env->GetByteArrayElements(arr, nullptr); },
+        [](JNIEnv *env, jbyteArray arr, jbyte *elements) { env->ReleaseByteArrayElements(arr, elements, JNI_ABORT); },
+        env, ptr, keys, matrix, threads, usearch_scalar_i8_k);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1batch_1b1
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jbyteArray matrix, jlong threads) {
+    jarray_usearch_add_batch(
+        [](JNIEnv *env, jbyteArray arr) { return env->GetByteArrayElements(arr, nullptr); },
+        [](JNIEnv *env, jbyteArray arr, jbyte *elements) { env->ReleaseByteArrayElements(arr, elements, JNI_ABORT); },
+        env, ptr, keys, matrix, threads, usearch_scalar_b1_k);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1get_1batch_1f32
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jfloatArray matrix, jlong threads) {
+    return critical_usearch_get_batch(env, ptr, keys, matrix, sizeof(jfloat), threads, usearch_scalar_f32_k);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1get_1batch_1f64
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jdoubleArray matrix, jlong threads) {
+    return critical_usearch_get_batch(env, ptr, keys, matrix, sizeof(jdouble), threads, usearch_scalar_f64_k);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1get_1batch_1f16
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jshortArray matrix, jlong threads) {
+    return critical_usearch_get_batch(env, ptr, keys, matrix, sizeof(jshort), threads, usearch_scalar_f16_k);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1get_1batch_1i8
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jbyteArray matrix, jlong threads) {
+    return critical_usearch_get_batch(env, ptr, keys, matrix, sizeof(jbyte), threads, usearch_scalar_i8_k);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1get_1batch_1b1
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jbyteArray matrix, jlong threads) {
+    return critical_usearch_get_batch(env, ptr, keys, matrix, sizeof(jbyte), threads, usearch_scalar_b1_k);
+}
+
 JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search
 (JNIEnv *env, jobject, jlong ptr, jfloatArray query, jint count, jlongArray keys, jfloatArray distances) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
-    const auto arr = env->GetFloatArrayElements(query, nullptr);
-    const auto key_arr = env->GetLongArrayElements(keys, nullptr);
-    const auto distances_arr = env->GetFloatArrayElements(distances, nullptr);
+    return jarray_usearch_search(env, ptr, query, usearch_scalar_f32_k, count, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1f64
+(JNIEnv *env, jobject, jlong ptr, jdoubleArray query, jint count, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search(env, ptr, query, usearch_scalar_f64_k, count, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1f16
+(JNIEnv *env, jobject, jlong ptr, jshortArray query, jint count, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search(env, ptr, query, usearch_scalar_f16_k, count, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1i8
+(JNIEnv *env, jobject, jlong ptr, jbyteArray query, jint count, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search(env, ptr, query, usearch_scalar_i8_k, count, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1b1
+(JNIEnv *env, jobject, jlong ptr, jbyteArray query, jint count, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search(env, ptr, query, usearch_scalar_b1_k, count, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1filter_1init
+(JNIEnv *env, jobject, jint kind, jlongArray keys, jboolean exclude) {
+    const auto count = static_cast<size_t>(env->GetArrayLength(keys));
+    const auto keys_arr = env->GetLongArrayElements(keys, nullptr);
     usearch_error_t err = nullptr;
-    const auto size = usearch_search(p, arr, usearch_scalar_f32_k, static_cast<size_t>(count),
-                                     reinterpret_cast<usearch_key_t *>(key_arr), distances_arr, &err);
+    const auto filter = usearch_filter_init(static_cast<usearch_filter_kind_t>(kind),
+                                            reinterpret_cast<usearch_key_t *>(keys_arr), count, exclude == JNI_TRUE,
+                                            &err);
+    env->ReleaseLongArrayElements(keys, keys_arr, JNI_ABORT);
     if (err) {
         throw_usearch_exception(env, err);
         return 0;
     }
-    env->ReleaseFloatArrayElements(query, arr, JNI_OK);
-    env->ReleaseLongArrayElements(keys, key_arr, JNI_OK);
-    env->ReleaseFloatArrayElements(distances, distances_arr, JNI_OK);
-    return static_cast<jlong>(size);
+    return reinterpret_cast<jlong>(filter);
 }
 
-JNIEXPORT jboolean JNICALL Java_usearch_NativeBridge_usearch_1contains(JNIEnv *, jobject, jlong ptr, jlong key) {
-    return reinterpret_cast<unum::usearch::index_dense_t *>(ptr)->contains(key);
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1filter_1free
+(JNIEnv *, jobject, jlong filter) {
+    usearch_filter_free(reinterpret_cast<usearch_filter_t>(filter), nullptr);
 }
 
-JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1size
-(JNIEnv *env, jobject, jlong ptr) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1store_1map_1file
+(JNIEnv *env, jobject, jstring path, jint kind, jlong dimensions) {
     usearch_error_t err = nullptr;
-    const auto size = usearch_size(p, &err);
+    const auto path_buf = env->GetStringUTFChars(path, nullptr);
+    const auto store = usearch_store_map_file(path_buf, static_cast<usearch_scalar_kind_t>(kind),
+                                              static_cast<size_t>(dimensions), &err);
+    env->ReleaseStringUTFChars(path, path_buf);
     if (err) {
         throw_usearch_exception(env, err);
+        return 0;
     }
-    return static_cast<jlong>(size);
+    return reinterpret_cast<jlong>(store);
 }
 
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1store_1free
+(JNIEnv *, jobject, jlong store) {
+    usearch_store_free(reinterpret_cast<usearch_store_t>(store), nullptr);
+}
 
-JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1capacity
-(JNIEnv *env, jobject, jlong ptr) {
+// Reads full-precision `f32` vectors from a `usearch.VectorFetch` through one reusable `float[]`.
+struct jvm_fetch_t {
+    JNIEnv *env;
+    jobject callback;
+    jmethodID fetch;
+    jfloatArray vector;
+    jsize dimensions;
+};
+
+bool jvm_fetch(usearch_key_t key, void *vector, void *state) {
+    const auto &fetch = *static_cast<jvm_fetch_t *>(state);
+    // Once the callback has thrown, no further calls into the JVM are allowed.
+    if (fetch.env->ExceptionCheck()) {
+        return false;
+    }
+    const auto found = fetch.env->CallBooleanMethod(fetch.callback, fetch.fetch, static_cast<jlong>(key), fetch.vector);
+    if (fetch.env->ExceptionCheck() || found != JNI_TRUE) {
+        return false;
+    }
+    fetch.env->GetFloatArrayRegion(fetch.vector, 0, fetch.dimensions, static_cast<jfloat *>(vector));
+    return true;
+}
+
+// Without a `store`, a temporary one reading from `fetch` lives for this call only, as the callback needs its `env`.
+// The query is copied rather than pinned, because the callback re-enters the JVM.
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1rerank
+(JNIEnv *env, jobject, jlong ptr, jarray query, jint kind, jint count, jlong oversample, jlong store, jobject fetch,
+ jlongArray keys, jfloatArray distances) {
     const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    const auto query_kind = static_cast<usearch_scalar_kind_t>(kind);
+    const auto length = env->GetArrayLength(query);
     usearch_error_t err = nullptr;
-    const auto cap = usearch_capacity(p, &err);
+    const auto dimensions = usearch_dimensions(p, &err);
     if (err) {
         throw_usearch_exception(env, err);
+        return 0;
+    }
+    if (static_cast<size_t>(length) != dimensions) {
+        throw_illegal_argument(env, "Query length doesn't match the index dimensions");
+        return 0;
+    }
+    std::vector<jdouble> query_vec(length);
+    if (query_kind == usearch_scalar_f64_k) {
+        env->GetDoubleArrayRegion(static_cast<jdoubleArray>(query), 0, length, query_vec.data());
+    } else if (query_kind == usearch_scalar_f32_k) {
+        env->GetFloatArrayRegion(static_cast<jfloatArray>(query), 0, length,
+                                 reinterpret_cast<jfloat *>(query_vec.data()));
+    } else {
+        throw_illegal_argument(env, "Unsupported scalar kind");
+        return 0;
     }
-    return static_cast<jlong>(cap);
-}
 
-JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1reserve
-(JNIEnv *env, jobject, jlong ptr, jlong capacity) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
-    usearch_error_t err = nullptr;
-    usearch_reserve(p, capacity, &err);
+    auto rerank_store = reinterpret_cast<usearch_store_t>(store);
+    jvm_fetch_t fetch_state{};
+    if (!rerank_store) {
+        if (query_kind != usearch_scalar_f32_k) {
+            throw_illegal_argument(env, "Fetched vectors are always f32");
+            return 0;
+        }
+        fetch_state.env = env;
+        fetch_state.callback = fetch;
+        fetch_state.fetch = env->GetMethodID(env->GetObjectClass(fetch), "fetch", "(J[F)Z");
+        if (!fetch_state.fetch) {
+            return 0;
+        }
+        fetch_state.dimensions = static_cast<jsize>(length);
+        fetch_state.vector = env->NewFloatArray(fetch_state.dimensions);
+        if (!fetch_state.vector) {
+            return 0;
+        }
+        rerank_store = usearch_store_init_callback(jvm_fetch, &fetch_state, query_kind, length, &err);
+        if (err) {
+            throw_usearch_exception(env, err);
+            return 0;
+        }
+    }
+
+    std::vector<usearch_key_t> found_keys(count);
+    std::vector<usearch_distance_t> found_distances(count);
+    const auto found = usearch_search_rerank(p, query_vec.data(), query_kind, static_cast<size_t>(count),
+                                             static_cast<size_t>(oversample), rerank_store,
+                                             found_keys.data(), found_distances.data(), &err);
+    if (!store) {
+        usearch_store_free(rerank_store, nullptr);
+        env->DeleteLocalRef(fetch_state.vector);
+    }
+    // An exception thrown by the callback explains the failure better than the search does.
+    if (env->ExceptionCheck()) {
+        return 0;
+    }
     if (err) {
         throw_usearch_exception(env, err);
+        return 0;
     }
+    env->SetLongArrayRegion(keys, 0, static_cast<jsize>(found), reinterpret_cast<const jlong *>(found_keys.data()));
+    env->SetFloatArrayRegion(distances, 0, static_cast<jsize>(found), found_distances.data());
+    return static_cast<jlong>(found);
 }
 
-JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1save_1file
-(JNIEnv *env, jobject, jlong ptr, jstring path) {
-    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1filter_1f32
+(JNIEnv *env, jobject, jlong ptr, jfloatArray query, jint count, jlong filter, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search_filter(env, ptr, query, usearch_scalar_f32_k, count, filter, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1filter_1f64
+(JNIEnv *env, jobject, jlong ptr, jdoubleArray query, jint count, jlong filter, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search_filter(env, ptr, query, usearch_scalar_f64_k, count, filter, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1filter_1f16
+(JNIEnv *env, jobject, jlong ptr, jshortArray query, jint count, jlong filter, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search_filter(env, ptr, query, usearch_scalar_f16_k, count, filter, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1filter_1i8
+(JNIEnv *env, jobject, jlong ptr, jbyteArray query, jint count, jlong filter, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search_filter(env, ptr, query, usearch_scalar_i8_k, count, filter, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1filter_1b1
+(JNIEnv *env, jobject, jlong ptr, jbyteArray query, jint count, jlong filter, jlongArray keys, jfloatArray distances) {
+    return jarray_usearch_search_filter(env, ptr, query, usearch_scalar_b1_k, count, filter, keys, distances);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1add_1buffer
+(JNIEnv *env, jobject, jlong ptr, jlong key, jobject vec, jlong offset, jlong length, jint kind) {
+    const auto vector_kind = static_cast<usearch_scalar_kind_t>(kind);
+    const auto arr = direct_vector(env, ptr, vec, offset, length, vector_kind);
+    if (!arr) {
+        return;
+    }
     usearch_error_t err = nullptr;
-    auto *path_buf = env->GetStringUTFChars(path, nullptr);
-    usearch_save(p, path_buf, &err);
+    usearch_add(reinterpret_cast<usearch_index_t *>(ptr), key, arr, vector_kind, &err);
     if (err) {
         throw_usearch_exception(env, err);
     }
-    env->ReleaseStringUTFChars(path, path_buf);
 }
 
-JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1save_1buffer
-(JNIEnv *env, jobject, jlong ptr, jbyteArray buffer) {
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1buffer
+(JNIEnv *env, jobject, jlong ptr, jobject query, jlong offset, jlong length, jint kind, jint count, jlongArray keys,
+ jfloatArray distances) {
+    const auto query_kind = static_cast<usearch_scalar_kind_t>(kind);
+    const auto arr = direct_vector(env, ptr, query, offset, length, query_kind);
+    if (!arr) {
+        return 0;
+    }
+    return copied_usearch_search(env, ptr, arr, query_kind, count, keys, distances);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1batch
+(JNIEnv *env, jobject, jlong ptr, jfloatArray queries, jint queries_count, jint count, jlong threads, jlongArray keys,
+ jfloatArray distances, jlongArray counts) {
     const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    const auto rows = static_cast<size_t>(queries_count);
+    if (rows == 0) {
+        return 0;
+    }
+    const auto stride = matrix_stride(env, p, queries, rows, usearch_scalar_f32_k);
+    if (stride == 0 || !batch_outputs_fit(env, keys, distances, counts, rows, static_cast<size_t>(count))) {
+        return 0;
+    }
+    const auto arr = env->GetFloatArrayElements(queries, nullptr);
+    const auto key_arr = env->GetLongArrayElements(keys, nullptr);
+    const auto distances_arr = env->GetFloatArrayElements(distances, nullptr);
+    const auto counts_arr = env->GetLongArrayElements(counts, nullptr);
     usearch_error_t err = nullptr;
-    const auto buffer_len = env->GetArrayLength(buffer);
-    const auto buffer_ptr = env->GetByteArrayElements(buffer, nullptr);
-
-    usearch_save_buffer(
-        p,
-        buffer_ptr,
-        buffer_len,
-        &err
-    );
+    const auto size = usearch_search_batch(
+        p, arr, usearch_scalar_f32_k, rows, stride,
+        static_cast<size_t>(count), static_cast<size_t>(threads),
+        reinterpret_cast<usearch_key_t *>(key_arr), count * sizeof(jlong),
+        distances_arr, count * sizeof(jfloat),
+        reinterpret_cast<size_t *>(counts_arr), &err);
+    env->ReleaseFloatArrayElements(queries, arr, JNI_ABORT);
+    env->ReleaseLongArrayElements(keys, key_arr, 0);
+    env->ReleaseFloatArrayElements(distances, distances_arr, 0);
+    env->ReleaseLongArrayElements(counts, counts_arr, 0);
     if (err) {
         throw_usearch_exception(env, err);
+        return 0;
     }
-    env->ReleaseByteArrayElements(buffer, buffer_ptr, JNI_COMMIT);
+    return static_cast<jlong>(size);
 }
 
-JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1load_1file
-(JNIEnv *env, jobject, jlong ptr, jstring path) {
+// Rounds of the range search may grow the candidate list many times, so nothing is pinned meanwhile.
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1range_1search
+(JNIEnv *env, jobject, jlong ptr, jfloatArray query, jfloat max_distance, jint max_results, jlongArray keys,
+ jfloatArray distances) {
     const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, p, query, usearch_scalar_f32_k, vector)) {
+        return 0;
+    }
+    std::vector<usearch_key_t> found_keys(static_cast<size_t>(max_results));
+    std::vector<usearch_distance_t> found_distances(static_cast<size_t>(max_results));
     usearch_error_t err = nullptr;
-    auto *path_buf = env->GetStringUTFChars(path, nullptr);
-    usearch_load(p, path_buf, &err);
+    const auto size = usearch_range_search(p, vector.data(), usearch_scalar_f32_k, max_distance,
+                                           static_cast<size_t>(max_results), found_keys.data(),
+                                           found_distances.data(), &err);
     if (err) {
         throw_usearch_exception(env, err);
+        return 0;
     }
+    env->SetLongArrayRegion(keys, 0, static_cast<jsize>(size), reinterpret_cast<const jlong *>(found_keys.data()));
+    env->SetFloatArrayRegion(distances, 0, static_cast<jsize>(size), found_distances.data());
+    return static_cast<jlong>(size);
 }
 
-JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1load_1buffer
-(JNIEnv *env, jobject, jlong ptr, jbyteArray buffer) {
+// Rounds of the grouped search may ask for more candidates many times, so nothing is pinned meanwhile.
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1search_1grouped
+(JNIEnv *env, jobject, jlong ptr, jfloatArray query, jint count, jint aggregation, jlong top_m, jlongArray keys,
+ jfloatArray distances) {
     const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, p, query, usearch_scalar_f32_k, vector)) {
+        return 0;
+    }
+    std::vector<usearch_key_t> found_keys(static_cast<size_t>(count));
+    std::vector<usearch_distance_t> found_distances(static_cast<size_t>(count));
     usearch_error_t err = nullptr;
-    const auto buffer_len = env->GetArrayLength(buffer);
-    const auto buffer_ptr = env->GetByteArrayElements(buffer, nullptr);
-    usearch_load_buffer(
-        p,
-        buffer_ptr,
-        buffer_len,
-        &err
-    );
+    const auto size = usearch_search_grouped(p, vector.data(), usearch_scalar_f32_k, static_cast<size_t>(count),
+                                             static_cast<usearch_aggregation_t>(aggregation),
+                                             static_cast<size_t>(top_m), found_keys.data(), found_distances.data(),
+                                             &err);
     if (err) {
         throw_usearch_exception(env, err);
+        return 0;
     }
-    env->ReleaseByteArrayElements(buffer, buffer_ptr, JNI_COMMIT);
+    env->SetLongArrayRegion(keys, 0, static_cast<jsize>(size), reinterpret_cast<const jlong *>(found_keys.data()));
+    env->SetFloatArrayRegion(distances, 0, static_cast<jsize>(size), found_distances.data());
+    return static_cast<jlong>(size);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1range_1search_1batch
+(JNIEnv *env, jobject, jlong ptr, jfloatArray queries, jint queries_count, jfloat max_distance, jint max_results,
+ jlong threads, jlongArray keys, jfloatArray distances, jlongArray counts) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    const auto rows = static_cast<size_t>(queries_count);
+    if (rows == 0) {
+        return 0;
+    }
+    const auto stride = matrix_stride(env, p, queries, rows, usearch_scalar_f32_k);
+    if (stride == 0 || !batch_outputs_fit(env, keys, distances, counts, rows, static_cast<size_t>(max_results))) {
+        return 0;
+    }
+    const auto arr = env->GetFloatArrayElements(queries, nullptr);
+    const auto key_arr = env->GetLongArrayElements(keys, nullptr);
+    const auto distances_arr = env->GetFloatArrayElements(distances, nullptr);
+    const auto counts_arr = env->GetLongArrayElements(counts, nullptr);
+    usearch_error_t err = nullptr;
+    const auto size = usearch_range_search_batch(
+        p, arr, usearch_scalar_f32_k, rows, stride,
+        max_distance, static_cast<size_t>(max_results), static_cast<size_t>(threads),
+        reinterpret_cast<usearch_key_t *>(key_arr), max_results * sizeof(jlong),
+        distances_arr, max_results * sizeof(jfloat),
+        reinterpret_cast<size_t *>(counts_arr), &err);
+    env->ReleaseFloatArrayElements(queries, arr, JNI_ABORT);
+    env->ReleaseLongArrayElements(keys, key_arr, 0);
+    env->ReleaseFloatArrayElements(distances, distances_arr, 0);
+    env->ReleaseLongArrayElements(counts, counts_arr, 0);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    return static_cast<jlong>(size);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1exact_1search
+(JNIEnv *env, jobject, jfloatArray dataset, jfloatArray queries, jlong dimensions, jint metric_k, jint count,
+ jlong threads, jlongArray keys, jfloatArray distances) {
+    const auto dims = static_cast<size_t>(dimensions);
+    const auto dataset_count = static_cast<size_t>(env->GetArrayLength(dataset)) / dims;
+    const auto queries_count = static_cast<size_t>(env->GetArrayLength(queries)) / dims;
+    const auto dataset_arr = env->GetFloatArrayElements(dataset, nullptr);
+    const auto queries_arr = env->GetFloatArrayElements(queries, nullptr);
+    const auto key_arr = env->GetLongArrayElements(keys, nullptr);
+    const auto distances_arr = env->GetFloatArrayElements(distances, nullptr);
+    usearch_error_t err = nullptr;
+    usearch_exact_search(
+        dataset_arr, dataset_count, dims * sizeof(jfloat),
+        queries_arr, queries_count, dims * sizeof(jfloat),
+        usearch_scalar_f32_k, dims, static_cast<usearch_metric_kind_t>(metric_k),
+        static_cast<size_t>(count), static_cast<size_t>(threads),
+        reinterpret_cast<usearch_key_t *>(key_arr), count * sizeof(jlong),
+        distances_arr, count * sizeof(jfloat), &err);
+    env->ReleaseFloatArrayElements(dataset, dataset_arr, JNI_ABORT);
+    env->ReleaseFloatArrayElements(queries, queries_arr, JNI_ABORT);
+    env->ReleaseLongArrayElements(keys, key_arr, 0);
+    env->ReleaseFloatArrayElements(distances, distances_arr, 0);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1distances
+(JNIEnv *env, jobject, jfloatArray query, jfloatArray matrix, jint metric_k, jlong threads, jfloatArray distances) {
+    const auto dims = static_cast<size_t>(env->GetArrayLength(query));
+    const auto count = static_cast<size_t>(env->GetArrayLength(distances));
+    if (dims == 0 || count == 0) {
+        return;
+    }
+    const auto query_arr = env->GetPrimitiveArrayCritical(query, nullptr);
+    const auto matrix_arr = env->GetPrimitiveArrayCritical(matrix, nullptr);
+    const auto distances_arr = env->GetPrimitiveArrayCritical(distances, nullptr);
+    usearch_error_t err = nullptr;
+    usearch_distances(
+        query_arr, matrix_arr, count, dims * sizeof(jfloat),
+        usearch_scalar_f32_k, dims, static_cast<usearch_metric_kind_t>(metric_k), static_cast<size_t>(threads),
+        static_cast<usearch_distance_t *>(distances_arr), &err);
+    env->ReleasePrimitiveArrayCritical(distances, distances_arr, 0);
+    env->ReleasePrimitiveArrayCritical(matrix, matrix_arr, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(query, query_arr, JNI_ABORT);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1distances_1matrix
+(JNIEnv *env, jobject, jfloatArray queries, jfloatArray matrix, jlong dimensions, jint metric_k, jlong threads,
+ jfloatArray distances) {
+    const auto dims = static_cast<size_t>(dimensions);
+    const auto queries_count = static_cast<size_t>(env->GetArrayLength(queries)) / dims;
+    const auto count = static_cast<size_t>(env->GetArrayLength(matrix)) / dims;
+    if (queries_count == 0 || count == 0) {
+        return;
+    }
+    const auto queries_arr = env->GetPrimitiveArrayCritical(queries, nullptr);
+    const auto matrix_arr = env->GetPrimitiveArrayCritical(matrix, nullptr);
+    const auto distances_arr = env->GetPrimitiveArrayCritical(distances, nullptr);
+    usearch_error_t err = nullptr;
+    usearch_distances_matrix(
+        queries_arr, queries_count, dims * sizeof(jfloat),
+        matrix_arr, count, dims * sizeof(jfloat),
+        usearch_scalar_f32_k, dims, static_cast<usearch_metric_kind_t>(metric_k), static_cast<size_t>(threads),
+        static_cast<usearch_distance_t *>(distances_arr), count * sizeof(jfloat), &err);
+    env->ReleasePrimitiveArrayCritical(distances, distances_arr, 0);
+    env->ReleasePrimitiveArrayCritical(matrix, matrix_arr, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(queries, queries_arr, JNI_ABORT);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT jfloatArray JNICALL Java_usearch_NativeBridge_usearch_1distances_1buffer
+(JNIEnv *env, jobject, jobject queries, jlong queries_offset, jlong queries_length, jobject matrix, jlong matrix_offset,
+ jlong matrix_length, jlong dimensions, jint kind, jint metric_k, jlong threads) {
+    const auto queries_address = static_cast<const char *>(env->GetDirectBufferAddress(queries));
+    const auto matrix_address = static_cast<const char *>(env->GetDirectBufferAddress(matrix));
+    if (!queries_address || !matrix_address) {
+        throw_illegal_argument(env, "Buffer is not direct");
+        return nullptr;
+    }
+    const auto scalar_kind = static_cast<usearch_scalar_kind_t>(kind);
+    const auto dims = static_cast<size_t>(dimensions);
+    const auto stride = bytes_per_vector(scalar_kind, dims);
+    if (stride == 0) {
+        throw_illegal_argument(env, "Unsupported scalar kind");
+        return nullptr;
+    }
+    if (queries_length <= 0 || static_cast<size_t>(queries_length) % stride != 0 ||
+        matrix_length < 0 || static_cast<size_t>(matrix_length) % stride != 0) {
+        throw_illegal_argument(env, "Buffer does not hold a whole number of vectors");
+        return nullptr;
+    }
+    const auto queries_count = static_cast<size_t>(queries_length) / stride;
+    const auto count = static_cast<size_t>(matrix_length) / stride;
+    const auto distances = env->NewFloatArray(static_cast<jsize>(queries_count * count));
+    if (!distances || count == 0) {
+        return distances;
+    }
+    const auto distances_arr = env->GetPrimitiveArrayCritical(distances, nullptr);
+    usearch_error_t err = nullptr;
+    // A single query needs no tiling, every row is loaded once either way.
+    if (queries_count == 1) {
+        usearch_distances(
+            queries_address + queries_offset, matrix_address + matrix_offset, count, stride,
+            scalar_kind, dims, static_cast<usearch_metric_kind_t>(metric_k), static_cast<size_t>(threads),
+            static_cast<usearch_distance_t *>(distances_arr), &err);
+    } else {
+        usearch_distances_matrix(
+            queries_address + queries_offset, queries_count, stride,
+            matrix_address + matrix_offset, count, stride,
+            scalar_kind, dims, static_cast<usearch_metric_kind_t>(metric_k), static_cast<size_t>(threads),
+            static_cast<usearch_distance_t *>(distances_arr), count * sizeof(jfloat), &err);
+    }
+    env->ReleasePrimitiveArrayCritical(distances, distances_arr, 0);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return nullptr;
+    }
+    return distances;
+}
+
+JNIEXPORT jboolean JNICALL Java_usearch_NativeBridge_usearch_1contains(JNIEnv *env, jobject, jlong ptr, jlong key) {
+    usearch_error_t err = nullptr;
+    const auto contains = usearch_contains(reinterpret_cast<usearch_index_t *>(ptr), key, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return false;
+    }
+    return contains;
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1size
+(JNIEnv *env, jobject, jlong ptr) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto size = usearch_size(p, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    return static_cast<jlong>(size);
+}
+
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1capacity
+(JNIEnv *env, jobject, jlong ptr) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto cap = usearch_capacity(p, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    return static_cast<jlong>(cap);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1tombstones
+(JNIEnv *env, jobject, jlong ptr) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto tombstones = usearch_tombstones(p, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    return static_cast<jlong>(tombstones);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1compact
+(JNIEnv *env, jobject, jlong ptr, jlong threads) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    usearch_compact(p, static_cast<size_t>(threads), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1enable_1stats
+(JNIEnv *env, jobject, jlong ptr, jboolean enabled) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    usearch_enable_stats(p, enabled == JNI_TRUE, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1memory_1breakdown
+(JNIEnv *env, jobject, jlong ptr, jlongArray out) {
+    // Flattened in the order of the fields of `usearch_memory_breakdown_t`.
+    constexpr jsize fields = 6;
+    if (env->GetArrayLength(out) != fields) {
+        throw_illegal_argument(env, "Memory breakdown array has the wrong length");
+        return;
+    }
+    usearch_error_t err = nullptr;
+    usearch_memory_breakdown_t breakdown;
+    usearch_memory_breakdown(reinterpret_cast<usearch_index_t *>(ptr), &breakdown, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return;
+    }
+    const jlong flat[fields] = {
+        static_cast<jlong>(breakdown.graph), static_cast<jlong>(breakdown.vectors),
+        static_cast<jlong>(breakdown.lookup), static_cast<jlong>(breakdown.huge_pages),
+        static_cast<jlong>(breakdown.other), static_cast<jlong>(breakdown.total)
+    };
+    env->SetLongArrayRegion(out, 0, fields, flat);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1stats
+(JNIEnv *env, jobject, jlong ptr, jlongArray out) {
+    // Flattened as the five counters, then the search and the add latency histograms.
+    constexpr jsize counters = 5;
+    if (env->GetArrayLength(out) != counters + 2 * USEARCH_LATENCY_BUCKETS) {
+        throw_illegal_argument(env, "Stats array has the wrong length");
+        return;
+    }
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    usearch_stats_t stats;
+    usearch_stats(p, &stats, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return;
+    }
+    std::vector<jlong> flat;
+    flat.reserve(counters + 2 * USEARCH_LATENCY_BUCKETS);
+    flat.push_back(static_cast<jlong>(stats.searches));
+    flat.push_back(static_cast<jlong>(stats.hops));
+    flat.push_back(static_cast<jlong>(stats.distances));
+    flat.push_back(static_cast<jlong>(stats.filtered));
+    flat.push_back(static_cast<jlong>(stats.adds));
+    flat.insert(flat.end(), stats.search_latency, stats.search_latency + USEARCH_LATENCY_BUCKETS);
+    flat.insert(flat.end(), stats.add_latency, stats.add_latency + USEARCH_LATENCY_BUCKETS);
+    env->SetLongArrayRegion(out, 0, static_cast<jsize>(flat.size()), flat.data());
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1reset_1stats
+(JNIEnv *env, jobject, jlong ptr) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    usearch_reset_stats(p, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1enable_1cache
+(JNIEnv *env, jobject, jlong ptr, jlong capacity) {
+    usearch_error_t err = nullptr;
+    usearch_enable_cache(reinterpret_cast<usearch_index_t *>(ptr), static_cast<size_t>(capacity), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1cache_1stats
+(JNIEnv *env, jobject, jlong ptr, jlongArray out) {
+    // Flattened in the order of the fields of `usearch_cache_stats_t`.
+    constexpr jsize fields = 3;
+    if (env->GetArrayLength(out) != fields) {
+        throw_illegal_argument(env, "Cache stats array has the wrong length");
+        return;
+    }
+    usearch_error_t err = nullptr;
+    usearch_cache_stats_t stats;
+    usearch_cache_stats(reinterpret_cast<usearch_index_t *>(ptr), &stats, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return;
+    }
+    const jlong flat[fields] = {
+        static_cast<jlong>(stats.hits), static_cast<jlong>(stats.misses), static_cast<jlong>(stats.entries)
+    };
+    env->SetLongArrayRegion(out, 0, fields, flat);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1reserve
+(JNIEnv *env, jobject, jlong ptr, jlong capacity) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    usearch_reserve(p, capacity, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1change_1growth_1policy
+(JNIEnv *env, jobject, jlong ptr, jfloat factor, jlong min_step) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    usearch_change_growth_policy(p, factor, static_cast<size_t>(min_step), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1save_1file
+(JNIEnv *env, jobject, jlong ptr, jstring path) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    auto *path_buf = env->GetStringUTFChars(path, nullptr);
+    usearch_save(p, path_buf, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    env->ReleaseStringUTFChars(path, path_buf);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1save_1buffer
+(JNIEnv *env, jobject, jlong ptr, jbyteArray buffer) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto buffer_len = env->GetArrayLength(buffer);
+    const auto buffer_ptr = env->GetByteArrayElements(buffer, nullptr);
+
+    usearch_save_buffer(
+        p,
+        buffer_ptr,
+        buffer_len,
+        &err
+    );
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    env->ReleaseByteArrayElements(buffer, buffer_ptr, JNI_COMMIT);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1load_1file
+(JNIEnv *env, jobject, jlong ptr, jstring path) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    auto *path_buf = env->GetStringUTFChars(path, nullptr);
+    usearch_load(p, path_buf, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1save_1stream
+(JNIEnv *env, jobject, jlong ptr, jobject write, jbyteArray buffer) {
+    jvm_stream_t stream{};
+    if (!jvm_stream_init(env, write, buffer, stream)) {
+        return;
+    }
+    usearch_error_t err = nullptr;
+    usearch_save_stream(reinterpret_cast<usearch_index_t *>(ptr), jvm_stream_write, &stream, &err);
+    // An exception thrown by the callback explains the failure better than the serializer does.
+    if (err && !env->ExceptionCheck()) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1load_1stream
+(JNIEnv *env, jobject, jlong ptr, jobject read, jbyteArray buffer) {
+    jvm_stream_t stream{};
+    if (!jvm_stream_init(env, read, buffer, stream)) {
+        return;
+    }
+    usearch_error_t err = nullptr;
+    usearch_load_stream(reinterpret_cast<usearch_index_t *>(ptr), jvm_stream_read, &stream, &err);
+    if (err && !env->ExceptionCheck()) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1view_1file
+(JNIEnv *env, jobject, jlong ptr, jstring path, jint advice) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto path_buf = env->GetStringUTFChars(path, nullptr);
+    usearch_view_file(p, path_buf, static_cast<usearch_view_advice_t>(advice), &err);
+    env->ReleaseStringUTFChars(path, path_buf);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1load_1huge_1pages
+(JNIEnv *env, jobject, jlong ptr, jstring path) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto path_buf = env->GetStringUTFChars(path, nullptr);
+    usearch_load_huge_pages(p, path_buf, &err);
+    env->ReleaseStringUTFChars(path, path_buf);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1wal_1open
+(JNIEnv *env, jobject, jlong ptr, jstring path, jlong sync_every) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto path_buf = env->GetStringUTFChars(path, nullptr);
+    const auto replayed = usearch_wal_open(p, path_buf, static_cast<size_t>(sync_every), &err);
+    env->ReleaseStringUTFChars(path, path_buf);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    return static_cast<jlong>(replayed);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1wal_1sync
+(JNIEnv *env, jobject, jlong ptr) {
+    usearch_error_t err = nullptr;
+    usearch_wal_sync(reinterpret_cast<usearch_index_t *>(ptr), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1wal_1close
+(JNIEnv *env, jobject, jlong ptr) {
+    usearch_error_t err = nullptr;
+    usearch_wal_close(reinterpret_cast<usearch_index_t *>(ptr), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1checkpoint
+(JNIEnv *env, jobject, jlong ptr, jstring path) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto path_buf = env->GetStringUTFChars(path, nullptr);
+    usearch_checkpoint(p, path_buf, &err);
+    env->ReleaseStringUTFChars(path, path_buf);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1checkpoint_1every
+(JNIEnv *env, jobject, jlong ptr, jstring path, jlong interval_ms, jlong min_records) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto path_buf = env->GetStringUTFChars(path, nullptr);
+    usearch_checkpoint_every(p, path_buf, static_cast<size_t>(interval_ms), static_cast<size_t>(min_records), &err);
+    env->ReleaseStringUTFChars(path, path_buf);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1queue_1init
+(JNIEnv *env, jobject, jlong ptr, jlong depth, jlong batch, jlong threads) {
+    usearch_error_t err = nullptr;
+    usearch_queue_init(reinterpret_cast<usearch_index_t *>(ptr), static_cast<size_t>(depth), static_cast<size_t>(batch),
+                       static_cast<size_t>(threads), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1queue_1free
+(JNIEnv *env, jobject, jlong ptr) {
+    usearch_error_t err = nullptr;
+    usearch_queue_free(reinterpret_cast<usearch_index_t *>(ptr), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+// The dispatcher thread of a request queue is attached on its first completion and detached when it exits.
+struct jvm_attachment_t {
+    JavaVM *vm = nullptr;
+    JNIEnv *env = nullptr;
+
+    ~jvm_attachment_t() {
+        if (vm) {
+            vm->DetachCurrentThread();
+        }
+    }
+};
+
+JNIEnv *attached_env(JavaVM *vm) {
+    static thread_local jvm_attachment_t attachment;
+    if (!attachment.env) {
+#ifdef __ANDROID__
+        vm->AttachCurrentThreadAsDaemon(&attachment.env, nullptr);
+#else
+        vm->AttachCurrentThreadAsDaemon(reinterpret_cast<void **>(&attachment.env), nullptr);
+#endif
+        attachment.vm = vm;
+    }
+    return attachment.env;
+}
+
+struct jvm_completion_t {
+    JavaVM *vm;
+    jobject callback;
+};
+
+// Hands the outcome to `QueueCallback.completed` and drops the callback, which is only ever completed once.
+void jvm_complete(const jvm_completion_t *completion, const usearch_key_t *keys, const usearch_distance_t *distances,
+                  const size_t found, const usearch_error_t error) {
+    const auto env = attached_env(completion->vm);
+    // Nothing unwinds the frames of this thread, so the local references are freed with a frame of their own.
+    if (env->PushLocalFrame(4) == JNI_OK) {
+        const auto method = env->GetMethodID(env->GetObjectClass(completion->callback), "completed",
+                                             "([J[FLjava/lang/String;)V");
+        jlongArray key_arr = nullptr;
+        jfloatArray distances_arr = nullptr;
+        if (keys && !error) {
+            key_arr = env->NewLongArray(static_cast<jsize>(found));
+            distances_arr = env->NewFloatArray(static_cast<jsize>(found));
+            env->SetLongArrayRegion(key_arr, 0, static_cast<jsize>(found), reinterpret_cast<const jlong *>(keys));
+            env->SetFloatArrayRegion(distances_arr, 0, static_cast<jsize>(found), distances);
+        }
+        const auto message = error ? env->NewStringUTF(error) : nullptr;
+        env->CallVoidMethod(completion->callback, method, key_arr, distances_arr, message);
+        env->PopLocalFrame(nullptr);
+    }
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+    }
+    env->DeleteGlobalRef(completion->callback);
+    delete completion;
+}
+
+void jvm_searched(const usearch_key_t *keys, const usearch_distance_t *distances, const size_t found,
+                  const usearch_error_t error, void *state) {
+    jvm_complete(static_cast<jvm_completion_t *>(state), keys, distances, found, error);
+}
+
+void jvm_added(const usearch_error_t error, void *state) {
+    jvm_complete(static_cast<jvm_completion_t *>(state), nullptr, nullptr, 0, error);
+}
+
+jvm_completion_t *new_completion(JNIEnv *env, const jobject callback) {
+    const auto completion = new jvm_completion_t();
+    env->GetJavaVM(&completion->vm);
+    completion->callback = env->NewGlobalRef(callback);
+    return completion;
+}
+
+// A rejected or failed submission never completes, so its callback is dropped right away.
+jboolean finish_submission(JNIEnv *env, jvm_completion_t *completion, const bool accepted,
+                           const usearch_error_t err) {
+    if (!accepted) {
+        env->DeleteGlobalRef(completion->callback);
+        delete completion;
+    }
+    if (err) {
+        throw_usearch_exception(env, err);
+        return JNI_FALSE;
+    }
+    return accepted ? JNI_TRUE : JNI_FALSE;
+}
+
+// The vector is copied out before submitting, as the submission waits for the queue's lock.
+JNIEXPORT jboolean JNICALL Java_usearch_NativeBridge_usearch_1submit_1search
+(JNIEnv *env, jobject, jlong ptr, jfloatArray query, jint count, jobject callback) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, p, query, usearch_scalar_f32_k, vector)) {
+        return JNI_FALSE;
+    }
+    const auto completion = new_completion(env, callback);
+    usearch_error_t err = nullptr;
+    const auto accepted = usearch_submit_search(p, vector.data(), usearch_scalar_f32_k, static_cast<size_t>(count),
+                                                jvm_searched, completion, &err);
+    return finish_submission(env, completion, accepted, err);
+}
+
+JNIEXPORT jboolean JNICALL Java_usearch_NativeBridge_usearch_1submit_1add
+(JNIEnv *env, jobject, jlong ptr, jlong key, jfloatArray vec, jobject callback) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, p, vec, usearch_scalar_f32_k, vector)) {
+        return JNI_FALSE;
+    }
+    const auto completion = new_completion(env, callback);
+    usearch_error_t err = nullptr;
+    const auto accepted = usearch_submit_add(p, static_cast<usearch_key_t>(key), vector.data(), usearch_scalar_f32_k,
+                                             jvm_added, completion, &err);
+    return finish_submission(env, completion, accepted, err);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1load_1buffer
+(JNIEnv *env, jobject, jlong ptr, jbyteArray buffer) {
+    const auto p = reinterpret_cast<usearch_index_t *>(ptr);
+    usearch_error_t err = nullptr;
+    const auto buffer_len = env->GetArrayLength(buffer);
+    const auto buffer_ptr = env->GetByteArrayElements(buffer, nullptr);
+    usearch_load_buffer(
+        p,
+        buffer_ptr,
+        buffer_len,
+        &err
+    );
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    env->ReleaseByteArrayElements(buffer, buffer_ptr, JNI_COMMIT);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1sharded_1init
+(JNIEnv *env, jobject, jlong opts, jlong shards) {
+    usearch_error_t err = nullptr;
+    const auto sharded = usearch_sharded_init(reinterpret_cast<usearch_init_options_t *>(opts),
+                                              static_cast<size_t>(shards), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    return reinterpret_cast<jlong>(sharded);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1sharded_1free
+(JNIEnv *, jobject, jlong ptr) {
+    usearch_error_t err = nullptr;
+    usearch_sharded_free(reinterpret_cast<usearch_sharded_t>(ptr), &err);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1sharded_1shard
+(JNIEnv *env, jobject, jlong ptr, jlong shard) {
+    usearch_error_t err = nullptr;
+    const auto index = usearch_sharded_shard(reinterpret_cast<usearch_sharded_t>(ptr), static_cast<size_t>(shard),
+                                             &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    return reinterpret_cast<jlong>(index);
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1sharded_1size
+(JNIEnv *env, jobject, jlong ptr) {
+    usearch_error_t err = nullptr;
+    const auto size = usearch_sharded_size(reinterpret_cast<usearch_sharded_t>(ptr), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+    return static_cast<jlong>(size);
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1sharded_1add
+(JNIEnv *env, jobject, jlong ptr, jlong key, jfloatArray vec) {
+    const auto sharded = reinterpret_cast<usearch_sharded_t>(ptr);
+    usearch_error_t err = nullptr;
+    const auto shard = usearch_sharded_shard(sharded, 0, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return;
+    }
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, shard, vec, usearch_scalar_f32_k, vector)) {
+        return;
+    }
+    usearch_sharded_add(sharded, key, vector.data(), usearch_scalar_f32_k, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1sharded_1add_1batch
+(JNIEnv *env, jobject, jlong ptr, jlongArray keys, jfloatArray matrix) {
+    const auto count = static_cast<size_t>(env->GetArrayLength(keys));
+    if (count == 0) {
+        return;
+    }
+    const auto sharded = reinterpret_cast<usearch_sharded_t>(ptr);
+    usearch_error_t err = nullptr;
+    // Shards share their options, so the first one tells the dimensions of all.
+    const auto shard = usearch_sharded_shard(sharded, 0, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return;
+    }
+    const auto stride = matrix_stride(env, shard, matrix, count, usearch_scalar_f32_k);
+    if (stride == 0) {
+        return;
+    }
+    const auto keys_arr = env->GetLongArrayElements(keys, nullptr);
+    const auto matrix_arr = env->GetFloatArrayElements(matrix, nullptr);
+    usearch_sharded_add_batch(sharded, reinterpret_cast<usearch_key_t *>(keys_arr), matrix_arr, count, stride,
+                              usearch_scalar_f32_k, &err);
+    env->ReleaseFloatArrayElements(matrix, matrix_arr, JNI_ABORT);
+    env->ReleaseLongArrayElements(keys, keys_arr, JNI_ABORT);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT void JNICALL Java_usearch_NativeBridge_usearch_1sharded_1remove
+(JNIEnv *env, jobject, jlong ptr, jlong key) {
+    usearch_error_t err = nullptr;
+    usearch_sharded_remove(reinterpret_cast<usearch_sharded_t>(ptr), key, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_usearch_NativeBridge_usearch_1sharded_1contains
+(JNIEnv *env, jobject, jlong ptr, jlong key) {
+    usearch_error_t err = nullptr;
+    const auto contains = usearch_sharded_contains(reinterpret_cast<usearch_sharded_t>(ptr), key, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return false;
+    }
+    return contains;
+}
+
+JNIEXPORT jlong JNICALL Java_usearch_NativeBridge_usearch_1sharded_1search
+(JNIEnv *env, jobject, jlong ptr, jfloatArray query, jint count, jlongArray keys, jfloatArray distances) {
+    const auto sharded = reinterpret_cast<usearch_sharded_t>(ptr);
+    usearch_error_t err = nullptr;
+    const auto shard = usearch_sharded_shard(sharded, 0, &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    // The fan-out waits for every shard, so nothing is pinned meanwhile.
+    std::vector<std::uint64_t> vector;
+    if (!copy_vector(env, shard, query, usearch_scalar_f32_k, vector)) {
+        return 0;
+    }
+    std::vector<usearch_key_t> found_keys(static_cast<size_t>(count));
+    std::vector<usearch_distance_t> found_distances(static_cast<size_t>(count));
+    const auto size = usearch_sharded_search(sharded, vector.data(), usearch_scalar_f32_k, static_cast<size_t>(count),
+                                             found_keys.data(), found_distances.data(), &err);
+    if (err) {
+        throw_usearch_exception(env, err);
+        return 0;
+    }
+    env->SetLongArrayRegion(keys, 0, static_cast<jsize>(size), reinterpret_cast<const jlong *>(found_keys.data()));
+    env->SetFloatArrayRegion(distances, 0, static_cast<jsize>(size), found_distances.data());
+    return static_cast<jlong>(size);
 }
 }
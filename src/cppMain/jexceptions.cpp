@@ -21,3 +21,8 @@ void throw_index_out_of_bounds(JNIEnv *env, const jint index) {
     ss << "index " << index << " is out of bounds";
     env->ThrowNew(err_cls, ss.str().c_str());
 }
+
+void throw_illegal_argument(JNIEnv *env, char const *msg) {
+    const auto err_cls = env->FindClass("java/lang/IllegalArgumentException");
+    env->ThrowNew(err_cls, msg);
+}
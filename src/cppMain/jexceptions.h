@@ -14,4 +14,6 @@ void throw_usearch_exception(JNIEnv *env, char const *msg);
 
 void throw_index_out_of_bounds(JNIEnv *env, const jint index);
 
+void throw_illegal_argument(JNIEnv *env, char const *msg);
+
 #endif //JEXCEPTIONS_H
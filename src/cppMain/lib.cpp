@@ -1,4 +1,30 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/mman.h> // `madvise`, `mmap`
+#include <unistd.h>   // `fsync`, `truncate`
+#else
+#include <io.h> // `_commit`, `_chsize_s`
+#endif
 
 #include <usearch/index_dense.hpp>
 
@@ -23,6 +49,21 @@ using labeling_result_t = typename index_dense_t::labeling_result_t;
 static_assert(std::is_same<usearch_key_t, index_dense_t::vector_key_t>::value, "Type mismatch between C and C++");
 static_assert(std::is_same<usearch_distance_t, index_dense_t::distance_t>::value, "Type mismatch between C and C++");
 
+/// Batches of `usearch_get_batch` smaller than this are copied on the calling thread.
+static constexpr std::size_t get_batch_parallel_threshold_k = 1024;
+
+/// Number of neighbors the first round of a range search asks for, doubled every round that stays within the radius.
+static constexpr std::size_t range_search_initial_k = 32;
+
+/// Candidates the first round of a grouped search asks for per distinct key, doubled every round that finds too few.
+static constexpr std::size_t grouped_search_oversample_k = 4;
+
+/// Distance computations touching fewer scalars than this run on the calling thread.
+static constexpr std::size_t distances_parallel_threshold_k = 1 << 18;
+
+/// Bytes of matrix rows in one tile of `usearch_distances_matrix`, sized to stay in the L2 cache of most cores.
+static constexpr std::size_t distances_tile_bytes_k = 128 * 1024;
+
 metric_kind_t metric_kind_to_cpp(usearch_metric_kind_t kind) {
     switch (kind) {
         case usearch_metric_ip_k: return metric_kind_t::ip_k;
@@ -77,6 +118,1010 @@ usearch_scalar_kind_t scalar_kind_to_c(scalar_kind_t kind) {
     }
 }
 
+/**
+ *  @brief  Readers-writer lock, as C++11 has no `std::shared_mutex`. Readers only touch two atomics
+ *          while no writer is around; a writer blocks new readers and waits for the active ones to leave.
+ */
+class shared_mutex_t {
+    std::atomic<std::size_t> readers_{0};
+    std::atomic<bool> writer_{false};
+    std::mutex mutex_;
+    std::condition_variable changed_;
+
+  public:
+    void lock_shared() {
+        for (;;) {
+            readers_.fetch_add(1);
+            if (!writer_.load())
+                return;
+            // Back off, letting the writer know one reader less is in the way, and retry once it's gone.
+            readers_.fetch_sub(1);
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.notify_all();
+            changed_.wait(lock, [this] { return !writer_.load(); });
+        }
+    }
+
+    void unlock_shared() {
+        if (readers_.fetch_sub(1) == 1 && writer_.load()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            changed_.notify_all();
+        }
+    }
+
+    void lock() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait(lock, [this] { return !writer_.load(); });
+        writer_.store(true);
+        changed_.wait(lock, [this] { return readers_.load() == 0; });
+    }
+
+    void unlock() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writer_.store(false);
+        }
+        changed_.notify_all();
+    }
+};
+
+/**
+ *  @brief  Work counters and latency histograms of one index. Threads are spread over stripes of counters,
+ *          so that concurrent searches rarely contend for a cache line. Stripes are only allocated once
+ *          statistics are enabled, and are kept until the index is freed, as in-flight operations may still
+ *          be recording into them.
+ */
+class index_stats_t {
+  public:
+    struct stripe_t {
+        std::atomic<std::size_t> searches;
+        std::atomic<std::size_t> hops;
+        std::atomic<std::size_t> distances;
+        std::atomic<std::size_t> filtered;
+        std::atomic<std::size_t> adds;
+        std::atomic<std::size_t> search_latency[USEARCH_LATENCY_BUCKETS];
+        std::atomic<std::size_t> add_latency[USEARCH_LATENCY_BUCKETS];
+        char padding[64];
+
+        stripe_t() noexcept { reset(); }
+
+        void reset() noexcept {
+            searches.store(0), hops.store(0), distances.store(0), filtered.store(0), adds.store(0);
+            for (std::size_t i = 0; i != USEARCH_LATENCY_BUCKETS; ++i)
+                search_latency[i].store(0), add_latency[i].store(0);
+        }
+    };
+
+  private:
+    static constexpr std::size_t stripes_k = 16;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<stripe_t *> stripes_{nullptr};
+    std::mutex allocation_mutex_;
+
+  public:
+    ~index_stats_t() { delete[] stripes_.load(); }
+
+    /// @return The stripe of the calling thread, or `nullptr` while statistics are disabled.
+    stripe_t *stripe() noexcept {
+        // Pairs with the release in `enable`, so that the stripes are visible once statistics are.
+        if (!enabled_.load(std::memory_order_acquire))
+            return nullptr;
+        static std::atomic<std::size_t> threads(0);
+        static thread_local std::size_t const thread = threads.fetch_add(1, std::memory_order_relaxed);
+        return stripes_.load(std::memory_order_relaxed) + thread % stripes_k;
+    }
+
+    bool enable(bool enabled) {
+        if (enabled && !stripes_.load()) {
+            std::lock_guard<std::mutex> lock(allocation_mutex_);
+            if (!stripes_.load()) {
+                stripe_t *stripes = new (std::nothrow) stripe_t[stripes_k];
+                if (!stripes)
+                    return false;
+                stripes_.store(stripes, std::memory_order_release);
+            }
+        }
+        enabled_.store(enabled, std::memory_order_release);
+        return true;
+    }
+
+    void reset() noexcept {
+        if (stripe_t *stripes = stripes_.load())
+            for (std::size_t i = 0; i != stripes_k; ++i)
+                stripes[i].reset();
+    }
+
+    void export_to(usearch_stats_t &stats) const noexcept {
+        std::memset(&stats, 0, sizeof(stats));
+        stripe_t const *stripes = stripes_.load();
+        if (!stripes)
+            return;
+        for (std::size_t i = 0; i != stripes_k; ++i) {
+            stripe_t const &stripe = stripes[i];
+            stats.searches += stripe.searches.load(std::memory_order_relaxed);
+            stats.hops += stripe.hops.load(std::memory_order_relaxed);
+            stats.distances += stripe.distances.load(std::memory_order_relaxed);
+            stats.filtered += stripe.filtered.load(std::memory_order_relaxed);
+            stats.adds += stripe.adds.load(std::memory_order_relaxed);
+            for (std::size_t bucket = 0; bucket != USEARCH_LATENCY_BUCKETS; ++bucket) {
+                stats.search_latency[bucket] += stripe.search_latency[bucket].load(std::memory_order_relaxed);
+                stats.add_latency[bucket] += stripe.add_latency[bucket].load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+/**
+ *  @brief  Log-linear bucket of a latency, keeping 8 sub-buckets per power of two,
+ *          which bounds the relative error to 12.5%, like a 1-digit HDR histogram.
+ */
+std::size_t latency_bucket_(std::uint64_t nanos) noexcept {
+    if (nanos < 8)
+        return static_cast<std::size_t>(nanos);
+    std::size_t msb = 0;
+    for (std::uint64_t rest = nanos; rest >>= 1;)
+        ++msb;
+    std::size_t const bucket = (msb - 2) * 8 + static_cast<std::size_t>((nanos >> (msb - 3)) & 7);
+    return bucket < USEARCH_LATENCY_BUCKETS ? bucket : USEARCH_LATENCY_BUCKETS - 1;
+}
+
+/**
+ *  @brief  Times one search or insertion and records the work it reports, unless statistics are disabled.
+ */
+class stats_probe_t {
+    index_stats_t::stripe_t *stripe_;
+    std::chrono::steady_clock::time_point start_;
+
+    std::size_t elapsed_bucket_() const noexcept {
+        auto const elapsed = std::chrono::steady_clock::now() - start_;
+        return latency_bucket_(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+  public:
+    explicit stats_probe_t(index_stats_t &stats) noexcept : stripe_(stats.stripe()) {
+        if (stripe_)
+            start_ = std::chrono::steady_clock::now();
+    }
+
+    template<typename result_at>
+    void searched(result_at const &result, std::size_t filtered = 0) noexcept {
+        if (!stripe_)
+            return;
+        stripe_->search_latency[elapsed_bucket_()].fetch_add(1, std::memory_order_relaxed);
+        stripe_->searches.fetch_add(1, std::memory_order_relaxed);
+        stripe_->hops.fetch_add(result.visited_members, std::memory_order_relaxed);
+        stripe_->distances.fetch_add(result.computed_distances, std::memory_order_relaxed);
+        stripe_->filtered.fetch_add(filtered, std::memory_order_relaxed);
+    }
+
+    template<typename result_at>
+    void added(result_at const &result) noexcept {
+        if (!stripe_)
+            return;
+        stripe_->add_latency[elapsed_bucket_()].fetch_add(1, std::memory_order_relaxed);
+        stripe_->adds.fetch_add(1, std::memory_order_relaxed);
+        stripe_->hops.fetch_add(result.visited_members, std::memory_order_relaxed);
+        stripe_->distances.fetch_add(result.computed_distances, std::memory_order_relaxed);
+    }
+};
+
+/**
+ *  @brief  Flushes a file all the way to the storage device, not just to the page cache.
+ */
+bool sync_file_(std::FILE *file) noexcept {
+    if (std::fflush(file) != 0)
+        return false;
+#if !defined(_WIN32)
+    return ::fsync(::fileno(file)) == 0;
+#else
+    return ::_commit(::_fileno(file)) == 0;
+#endif
+}
+
+/**
+ *  @brief  Append-only log of the changes made to an index since its last snapshot, see `usearch_wal_open`.
+ *          The file starts with `wal_magic_k`, followed by records of
+ *          `[operation: u8][key: u64][payload][checksum: u32]` in native byte order.
+ *          The checksum covers the whole record before it, so a record torn by a crash ends the replay.
+ */
+class write_ahead_log_t {
+  public:
+    enum operation_t : std::uint8_t { add_k = 1, remove_k = 2, rename_k = 3, clear_k = 4 };
+
+    static constexpr char wal_magic_k[8] = {'U', 'S', 'E', 'A', 'R', 'W', 'A', 'L'};
+
+    static std::uint32_t checksum(byte_t const *data, std::size_t length) noexcept {
+        std::uint32_t hash = 2166136261u; // FNV-1a
+        for (std::size_t i = 0; i != length; ++i)
+            hash = (hash ^ data[i]) * 16777619u;
+        return hash;
+    }
+
+  private:
+    std::FILE *file_ = nullptr;
+    std::string path_;
+    std::size_t sync_every_ = 0;
+    std::size_t unsynced_ = 0;
+    std::size_t records_ = 0;
+    std::mutex mutex_;
+    std::vector<byte_t> record_;
+
+    template<typename scalar_at>
+    void put_(scalar_at value) {
+        byte_t const *bytes = reinterpret_cast<byte_t const *>(&value);
+        record_.insert(record_.end(), bytes, bytes + sizeof(value));
+    }
+
+    void begin_(operation_t operation, usearch_key_t key) {
+        record_.clear();
+        put_(static_cast<std::uint8_t>(operation));
+        put_(key);
+    }
+
+    /// Seals the record in `record_` and hands it to the file, syncing once enough records have piled up.
+    bool commit_() {
+        put_(checksum(record_.data(), record_.size()));
+        if (std::fwrite(record_.data(), 1, record_.size(), file_) != record_.size())
+            return false;
+        ++records_;
+        if (sync_every_ && ++unsynced_ >= sync_every_) {
+            unsynced_ = 0;
+            return sync_file_(file_);
+        }
+        return true;
+    }
+
+  public:
+    ~write_ahead_log_t() {
+        if (file_) {
+            sync_file_(file_);
+            std::fclose(file_);
+        }
+    }
+
+    /// Opens @p path for appending after its first @p valid_length bytes, discarding a torn tail past them.
+    /// @param records Number of records in those bytes.
+    usearch_error_t open(char const *path, std::size_t valid_length, std::size_t records, std::size_t sync_every) {
+        path_ = path;
+        sync_every_ = sync_every;
+        records_ = records;
+        if (valid_length < sizeof(wal_magic_k)) {
+            file_ = std::fopen(path, "wb");
+            if (!file_)
+                return "Failed to create the log file!";
+            if (std::fwrite(wal_magic_k, 1, sizeof(wal_magic_k), file_) != sizeof(wal_magic_k) || !sync_file_(file_))
+                return "Failed to write the log file!";
+            return nullptr;
+        }
+#if !defined(_WIN32)
+        if (::truncate(path, static_cast<off_t>(valid_length)) != 0)
+            return "Failed to truncate the torn tail of the log file!";
+        file_ = std::fopen(path, "ab");
+#else
+        file_ = std::fopen(path, "ab");
+        if (file_ && ::_chsize_s(::_fileno(file_), static_cast<long long>(valid_length)) != 0)
+            return "Failed to truncate the torn tail of the log file!";
+#endif
+        return file_ ? nullptr : "Failed to open the log file!";
+    }
+
+    bool log_add(usearch_key_t key, void const *vector, usearch_scalar_kind_t kind, std::size_t length) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        begin_(add_k, key);
+        put_(static_cast<std::uint8_t>(kind));
+        put_(static_cast<std::uint32_t>(length));
+        record_.insert(record_.end(), (byte_t const *) vector, (byte_t const *) vector + length);
+        return commit_() && std::fflush(file_) == 0;
+    }
+
+    /// Logs the rows of a batch insertion, skipping those whose @p added flag is zero, with a single flush.
+    bool log_add_batch(usearch_key_t const *keys, void const *vectors, std::size_t count, std::size_t stride,
+                       usearch_scalar_kind_t kind, std::size_t length, std::vector<char> const &added) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (std::size_t task = 0; task != count; ++task) {
+            if (!added[task])
+                continue;
+            begin_(add_k, keys[task]);
+            put_(static_cast<std::uint8_t>(kind));
+            put_(static_cast<std::uint32_t>(length));
+            byte_t const *vector = (byte_t const *) vectors + task * stride;
+            record_.insert(record_.end(), vector, vector + length);
+            if (!commit_())
+                return false;
+        }
+        return std::fflush(file_) == 0;
+    }
+
+    bool log_remove(usearch_key_t key) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        begin_(remove_k, key);
+        return commit_() && std::fflush(file_) == 0;
+    }
+
+    bool log_rename(usearch_key_t from, usearch_key_t to) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        begin_(rename_k, from);
+        put_(to);
+        return commit_() && std::fflush(file_) == 0;
+    }
+
+    bool log_clear() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        begin_(clear_k, 0);
+        return commit_() && std::fflush(file_) == 0;
+    }
+
+    bool sync() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        unsynced_ = 0;
+        return file_ && sync_file_(file_);
+    }
+
+    /// Number of records appended since the log was opened or last truncated.
+    std::size_t records() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return records_;
+    }
+
+    /// Drops all records, once a snapshot holding their effects is safely on disk.
+    usearch_error_t truncate() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::fclose(file_);
+        file_ = nullptr;
+        records_ = unsynced_ = 0;
+        // Still locked, as checkpoints truncate under shared access, alongside syncs.
+        return open(path_.c_str(), 0, 0, sync_every_);
+    }
+};
+
+constexpr char write_ahead_log_t::wal_magic_k[8];
+
+/**
+ *  @brief  Runs a task every so often on its own thread, until destroyed.
+ */
+class periodic_task_t {
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopped_ = false;
+    std::thread thread_;
+
+  public:
+    periodic_task_t(std::chrono::milliseconds interval, std::function<void()> task)
+        : thread_([this, interval, task] {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (!wake_.wait_for(lock, interval, [this] { return stopped_; })) {
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }) {}
+
+    ~periodic_task_t() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        wake_.notify_all();
+        thread_.join();
+    }
+};
+
+/**
+ *  @brief  Anonymous memory for `usearch_load_huge_pages`, backed by 2 MiB pages where the platform allows,
+ *          so that a few TLB entries cover the hot part of a large graph. Explicit huge pages are only there
+ *          if the administrator reserved them, otherwise transparent ones are requested for an aligned range.
+ *          Elsewhere, it's plain heap memory.
+ */
+class huge_page_arena_t {
+    byte_t *data_ = nullptr;
+    std::size_t length_ = 0;
+    bool explicit_ = false;
+
+  public:
+    static constexpr std::size_t page_bytes_k = 2 * 1024 * 1024;
+
+    huge_page_arena_t() = default;
+    huge_page_arena_t(huge_page_arena_t const &) = delete;
+    huge_page_arena_t &operator=(huge_page_arena_t const &) = delete;
+
+    ~huge_page_arena_t() {
+#if defined(__linux__)
+        if (data_)
+            ::munmap(data_, length_);
+#else
+        delete[] reinterpret_cast<std::uint64_t *>(data_);
+#endif
+    }
+
+    bool allocate(std::size_t bytes) {
+        length_ = (bytes + page_bytes_k - 1) / page_bytes_k * page_bytes_k;
+#if defined(__linux__)
+        void *data = ::mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        explicit_ = data != MAP_FAILED;
+        if (!explicit_) {
+            // Over-allocate by a page and trim both ends, so that the range starts on a huge page boundary.
+            std::size_t const padded = length_ + page_bytes_k;
+            data = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (data == MAP_FAILED)
+                return false;
+            std::uintptr_t const begin = reinterpret_cast<std::uintptr_t>(data);
+            std::uintptr_t const aligned = (begin + page_bytes_k - 1) & ~std::uintptr_t(page_bytes_k - 1);
+            if (aligned != begin)
+                ::munmap(data, aligned - begin);
+            if (begin + padded != aligned + length_)
+                ::munmap(reinterpret_cast<void *>(aligned + length_), begin + padded - aligned - length_);
+            data = reinterpret_cast<void *>(aligned);
+            // Without transparent huge pages in the kernel, this is just regular memory.
+            (void)::madvise(data, length_, MADV_HUGEPAGE);
+        }
+        data_ = static_cast<byte_t *>(data);
+#else
+        data_ = reinterpret_cast<byte_t *>(new (std::nothrow) std::uint64_t[length_ / sizeof(std::uint64_t)]);
+#endif
+        return data_ != nullptr;
+    }
+
+    byte_t *data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return length_; }
+    bool explicit_pages() const noexcept { return explicit_; }
+};
+
+/**
+ *  @brief  Mixes the bytes of a query a word at a time. Not meant to resist collisions,
+ *          which `query_cache_t` tells apart by comparing the bytes themselves.
+ */
+std::uint64_t hash_bytes_(byte_t const *bytes, std::size_t length) noexcept {
+    std::uint64_t hash = 0x9E3779B97F4A7C15ull ^ length;
+    std::size_t offset = 0;
+    for (; offset + sizeof(std::uint64_t) <= length; offset += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + offset, sizeof(word));
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, bytes + offset, length - offset);
+    hash = (hash ^ tail) * 0xC4CEB9FE1A85EC53ull;
+    return hash ^ (hash >> 29);
+}
+
+/**
+ *  @brief  Bounded LRU of search results, see `usearch_enable_cache`. Entries are spread over shards by the hash
+ *          of their query, each with its own lock, so that concurrent searches rarely contend. Every entry keeps
+ *          the version of the index it was computed at, and is only served while the index is still at it.
+ */
+class query_cache_t {
+  public:
+    struct query_t {
+        byte_t const *bytes;
+        std::size_t length;
+        usearch_scalar_kind_t kind;
+        std::size_t count;
+        std::size_t expansion;
+        std::uint64_t hash;
+
+        query_t(byte_t const *bytes, std::size_t length, usearch_scalar_kind_t kind, std::size_t count,
+                std::size_t expansion) noexcept
+            : bytes(bytes), length(length), kind(kind), count(count), expansion(expansion),
+              hash(hash_bytes_(bytes, length) ^ ((count * 0x9E3779B97F4A7C15ull) + (expansion << 8) + kind)) {}
+    };
+
+  private:
+    static constexpr std::size_t shards_k = 16;
+
+    struct entry_t {
+        std::uint64_t hash;
+        std::vector<byte_t> query;
+        usearch_scalar_kind_t kind;
+        std::size_t count;
+        std::size_t expansion;
+        std::size_t version;
+        std::vector<usearch_key_t> keys;
+        std::vector<usearch_distance_t> distances;
+
+        bool answers(query_t const &other) const noexcept {
+            return kind == other.kind && count == other.count && expansion == other.expansion &&
+                   query.size() == other.length && std::memcmp(query.data(), other.bytes, other.length) == 0;
+        }
+    };
+
+    struct shard_t {
+        std::mutex mutex;
+        /// Most recently used first.
+        std::list<entry_t> entries;
+        /// One entry per hash, so a colliding query replaces the previous one.
+        std::unordered_map<std::uint64_t, std::list<entry_t>::iterator> lookup;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+    };
+
+    std::size_t shard_capacity_;
+    shard_t shards_[shards_k];
+
+    shard_t &shard_(query_t const &query) noexcept { return shards_[(query.hash >> 56) % shards_k]; }
+
+  public:
+    explicit query_cache_t(std::size_t capacity) noexcept
+        : shard_capacity_(capacity > shards_k ? (capacity + shards_k - 1) / shards_k : 1) {}
+
+    /// @return Whether the results of @p query were copied into @p keys and @p distances, counting @p found.
+    bool find(query_t const &query, std::size_t version, usearch_key_t *keys, usearch_distance_t *distances,
+              std::size_t &found) {
+        shard_t &shard = shard_(query);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.lookup.find(query.hash);
+        if (it == shard.lookup.end() || !it->second->answers(query)) {
+            ++shard.misses;
+            return false;
+        }
+        entry_t const &entry = *it->second;
+        if (entry.version != version) {
+            shard.entries.erase(it->second);
+            shard.lookup.erase(it);
+            ++shard.misses;
+            return false;
+        }
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        found = entry.keys.size();
+        std::copy(entry.keys.begin(), entry.keys.end(), keys);
+        std::copy(entry.distances.begin(), entry.distances.end(), distances);
+        ++shard.hits;
+        return true;
+    }
+
+    /// Remembers the results of @p query, computed at @p version of the index. Fails silently when out of memory.
+    void insert(query_t const &query, std::size_t version, usearch_key_t const *keys,
+                usearch_distance_t const *distances, std::size_t found) noexcept try {
+        entry_t entry;
+        entry.hash = query.hash;
+        entry.query.assign(query.bytes, query.bytes + query.length);
+        entry.kind = query.kind;
+        entry.count = query.count;
+        entry.expansion = query.expansion;
+        entry.version = version;
+        entry.keys.assign(keys, keys + found);
+        entry.distances.assign(distances, distances + found);
+
+        shard_t &shard = shard_(query);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.lookup.find(query.hash);
+        if (it != shard.lookup.end()) {
+            *it->second = std::move(entry);
+            shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+            return;
+        }
+        if (shard.entries.size() == shard_capacity_) {
+            shard.lookup.erase(shard.entries.back().hash);
+            shard.entries.pop_back();
+        }
+        it = shard.lookup.emplace(query.hash, shard.entries.end()).first;
+        try {
+            shard.entries.push_front(std::move(entry));
+        } catch (...) {
+            shard.lookup.erase(it);
+            throw;
+        }
+        it->second = shard.entries.begin();
+    } catch (...) {
+    }
+
+    void export_to(usearch_cache_stats_t &stats) noexcept {
+        std::memset(&stats, 0, sizeof(stats));
+        for (shard_t &shard: shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            stats.hits += shard.hits;
+            stats.misses += shard.misses;
+            stats.entries += shard.entries.size();
+        }
+    }
+};
+
+class request_queue_t;
+
+/**
+ *  @brief  Everything the C layer keeps next to a dense index. This is what `usearch_index_t` points to.
+ */
+struct index_handle_t {
+    /// Set by `usearch_load_huge_pages` and viewed by `index`, so declared first to be freed after it.
+    /// Reset once a load or view replaces the contents of `index`.
+    std::unique_ptr<huge_page_arena_t> arena;
+    index_dense_t index;
+
+    /// Capacity multiplier applied when an insertion runs out of slots.
+    float growth_factor = 2;
+    /// Lower bound on the number of slots added in one growth step.
+    std::size_t growth_min_step = 64;
+    std::mutex growth_mutex;
+
+    /// Set by `usearch_init_options_t::key_lookups`.
+    usearch_key_lookups_t key_lookups = usearch_key_lookups_hash_k;
+
+    /// Set by `usearch_init_options_t::thread_safe`, guarding structural changes with `access_mutex`.
+    bool thread_safe = false;
+    shared_mutex_t access_mutex;
+    /// Taken shared by insertions, removals and renames ahead of `access_mutex`, and exclusively by checkpoints,
+    /// so that a snapshot only holds back changes while searches go on.
+    shared_mutex_t change_mutex;
+
+    index_stats_t stats;
+
+    /// Bumped by every change that may alter search results, making the cached ones stale.
+    std::atomic<std::size_t> version{0};
+    /// Set by `usearch_enable_cache`, replaced only under exclusive access.
+    std::unique_ptr<query_cache_t> cache;
+
+    /// Set by `usearch_wal_open`, replaced only under exclusive access.
+    std::unique_ptr<write_ahead_log_t> wal;
+    /// First failure of a background checkpoint, reported by the next `usearch_wal_sync`.
+    std::atomic<usearch_error_t> checkpoint_failure{nullptr};
+    /// Serializes `usearch_checkpoint_every` calls replacing `checkpointer`.
+    std::mutex checkpointer_mutex;
+    /// Set by `usearch_checkpoint_every`. Declared last, so that it stops before the rest is torn down.
+    std::unique_ptr<periodic_task_t> checkpointer;
+    /// Guards `queue` against submissions racing with `usearch_queue_init` and `usearch_queue_free`.
+    std::mutex queue_mutex;
+    /// Set by `usearch_queue_init`. Declared last as well, so that pending requests are answered first.
+    std::unique_ptr<request_queue_t> queue;
+    /// A queue stopped by one of its own completions, whose dispatcher can't join itself. It exits once the pending
+    /// requests are answered, and is joined by the next stop from another thread, or when the index is freed.
+    std::unique_ptr<request_queue_t> retired_queue;
+
+    index_handle_t() = default;
+    explicit index_handle_t(index_dense_t &&dense) : index(std::move(dense)) {}
+};
+
+index_handle_t &handle_(usearch_index_t index) { return *reinterpret_cast<index_handle_t *>(index); }
+
+/// Fails the operations that find members by key, unless the index keeps a table from keys to slots.
+bool has_key_lookups_(index_handle_t const &handle, usearch_error_t *error) {
+    if (handle.key_lookups == usearch_key_lookups_hash_k)
+        return true;
+    *error = "Needs key lookups, see `usearch_init_options_t::key_lookups`!";
+    return false;
+}
+
+/// Makes the cached search results stale. Called after a change, so that no search can see the index before it
+/// and cache its results at the version after it.
+void changed_(index_handle_t &handle) noexcept { handle.version.fetch_add(1, std::memory_order_acq_rel); }
+
+/**
+ *  @brief  Scope of an operation the dense index synchronizes on its own, like inserts, lookups and searches.
+ *          These only have to be kept apart from structural changes, and only in the thread-safe mode.
+ */
+class shared_access_t {
+    index_handle_t &owner_;
+
+  public:
+    explicit shared_access_t(index_handle_t &handle) : owner_(handle) {
+        if (owner_.thread_safe)
+            owner_.access_mutex.lock_shared();
+    }
+    explicit shared_access_t(usearch_index_t index) : shared_access_t(handle_(index)) {}
+    ~shared_access_t() {
+        if (owner_.thread_safe)
+            owner_.access_mutex.unlock_shared();
+    }
+    shared_access_t(shared_access_t const &) = delete;
+    shared_access_t &operator=(shared_access_t const &) = delete;
+};
+
+/**
+ *  @brief  Scope of a change to the contents, like an insertion, removal or rename, entered before the
+ *          `shared_access_t` or growth it needs. Only checkpoints wait for these, in the thread-safe mode.
+ */
+class change_access_t {
+    index_handle_t &owner_;
+    bool const engaged_;
+
+  public:
+    /// Enters nothing unless @p changing, for operations that only sometimes change the contents.
+    explicit change_access_t(index_handle_t &handle, bool changing = true)
+        : owner_(handle), engaged_(changing && handle.thread_safe) {
+        if (engaged_)
+            owner_.change_mutex.lock_shared();
+    }
+    ~change_access_t() {
+        if (engaged_)
+            owner_.change_mutex.unlock_shared();
+    }
+    change_access_t(change_access_t const &) = delete;
+    change_access_t &operator=(change_access_t const &) = delete;
+};
+
+/**
+ *  @brief  Scope of a structural change, like resizing, loading or swapping the metric,
+ *          which in the thread-safe mode waits for all other operations to finish.
+ */
+class exclusive_access_t {
+    index_handle_t &owner_;
+
+  public:
+    explicit exclusive_access_t(index_handle_t &handle) : owner_(handle) {
+        if (owner_.thread_safe)
+            owner_.access_mutex.lock();
+    }
+    explicit exclusive_access_t(usearch_index_t index) : exclusive_access_t(handle_(index)) {}
+    ~exclusive_access_t() {
+        if (owner_.thread_safe)
+            owner_.access_mutex.unlock();
+    }
+    exclusive_access_t(exclusive_access_t const &) = delete;
+    exclusive_access_t &operator=(exclusive_access_t const &) = delete;
+};
+
+index_dense_t *dense_(usearch_index_t index) { return &reinterpret_cast<index_handle_t *>(index)->index; }
+
+/**
+ *  @brief  Roaring-style set of keys. Keys are bucketed by their upper 48 bits, and every bucket
+ *          holds its lower 16 bits either as a sorted array, while sparse, or as a 65536-bit bitmap.
+ */
+class key_bitset_t {
+    static constexpr std::size_t array_limit_k = 4096;
+    static constexpr std::size_t bitmap_words_k = 65536 / 64;
+
+    struct bucket_t {
+        std::uint64_t high;
+        std::size_t begin;
+        std::size_t end;
+        bool bitmap;
+    };
+
+    std::vector<bucket_t> buckets_;
+    std::vector<std::uint16_t> lows_;
+    std::vector<std::uint64_t> words_;
+
+  public:
+    /// @param keys Must be sorted and unique.
+    explicit key_bitset_t(std::vector<usearch_key_t> const &keys) {
+        for (std::size_t i = 0; i != keys.size();) {
+            std::uint64_t const high = keys[i] >> 16;
+            std::size_t j = i;
+            while (j != keys.size() && keys[j] >> 16 == high)
+                ++j;
+            if (j - i <= array_limit_k) {
+                buckets_.push_back({high, lows_.size(), lows_.size() + (j - i), false});
+                for (; i != j; ++i)
+                    lows_.push_back(static_cast<std::uint16_t>(keys[i]));
+            } else {
+                buckets_.push_back({high, words_.size(), words_.size() + bitmap_words_k, true});
+                words_.resize(words_.size() + bitmap_words_k, 0);
+                std::uint64_t *bitmap = words_.data() + buckets_.back().begin;
+                for (; i != j; ++i)
+                    bitmap[(keys[i] & 0xFFFF) / 64] |= std::uint64_t(1) << (keys[i] % 64);
+            }
+        }
+    }
+
+    bool contains(usearch_key_t key) const noexcept {
+        std::uint64_t const high = key >> 16;
+        auto bucket = std::lower_bound(buckets_.begin(), buckets_.end(), high,
+                                       [](bucket_t const &b, std::uint64_t h) { return b.high < h; });
+        if (bucket == buckets_.end() || bucket->high != high)
+            return false;
+        std::uint16_t const low = static_cast<std::uint16_t>(key);
+        if (bucket->bitmap)
+            return (words_[bucket->begin + low / 64] >> (low % 64)) & 1;
+        return std::binary_search(lows_.begin() + bucket->begin, lows_.begin() + bucket->end, low);
+    }
+};
+
+struct sorted_keys_t {
+    std::vector<usearch_key_t> const &keys;
+    bool contains(usearch_key_t key) const noexcept { return std::binary_search(keys.begin(), keys.end(), key); }
+};
+
+struct hashed_keys_t {
+    std::unordered_set<usearch_key_t> const &keys;
+    bool contains(usearch_key_t key) const noexcept { return keys.count(key) != 0; }
+};
+
+/**
+ *  @brief  Native predicate behind `usearch_filter_t`, built once and evaluated entirely in C++ during search.
+ */
+struct key_filter_t {
+    usearch_filter_kind_t kind;
+    bool exclude;
+    std::vector<usearch_key_t> sorted;
+    std::unordered_set<usearch_key_t> hashed;
+    std::unique_ptr<key_bitset_t> bitset;
+};
+
+/**
+ *  @brief  Full-precision vectors behind `usearch_store_t`, either a mapped matrix indexed by key or a callback.
+ */
+struct vector_store_t {
+    scalar_kind_t kind;
+    std::size_t dimensions;
+    std::size_t row_bytes;
+    memory_mapped_file_t file;
+    byte_t const *rows_begin = nullptr;
+    std::size_t rows = 0;
+    usearch_fetch_t fetch = nullptr;
+    void *state = nullptr;
+
+    /// Locates the vector of @p key, copying it into @p scratch if it comes from the callback.
+    byte_t const *find(usearch_key_t key, byte_t *scratch) const {
+        if (!fetch)
+            return key < rows ? rows_begin + key * row_bytes : nullptr;
+        return fetch(key, scratch, state) ? scratch : nullptr;
+    }
+};
+
+/**
+ *  @brief  Coalesces the many small writes of `save_to_stream` into chunks, to keep callbacks into
+ *          managed runtimes rare. Pieces that don't fit into a chunk are passed through without copying.
+ */
+class chunked_output_t {
+    static constexpr std::size_t chunk_size_k = 64 * 1024;
+
+    usearch_write_t write_;
+    void *state_;
+    std::vector<byte_t> chunk_;
+
+  public:
+    chunked_output_t(usearch_write_t write, void *state) : write_(write), state_(state) {
+        chunk_.reserve(chunk_size_k);
+    }
+
+    bool operator()(void const *data, std::size_t length) {
+        if (chunk_.size() + length > chunk_size_k && !flush())
+            return false;
+        if (length >= chunk_size_k)
+            return write_(data, length, state_);
+        byte_t const *bytes = static_cast<byte_t const *>(data);
+        chunk_.insert(chunk_.end(), bytes, bytes + length);
+        return true;
+    }
+
+    bool flush() {
+        if (chunk_.empty())
+            return true;
+        bool const written = write_(chunk_.data(), chunk_.size(), state_);
+        chunk_.clear();
+        return written;
+    }
+};
+
+/**
+ *  @brief  Fixed set of worker threads kept alive between calls, so that fanning a single query out to every shard
+ *          doesn't pay for spawning threads. The calling thread takes part in the work. While the pool is busy
+ *          with another caller, tasks run on the calling thread instead, as concurrent callers already keep the
+ *          cores occupied.
+ */
+class task_pool_t {
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::size_t generation_ = 0;
+    std::size_t busy_ = 0;
+    bool stopping_ = false;
+
+    std::function<void(std::size_t)> const *task_ = nullptr;
+    std::size_t tasks_ = 0;
+    std::atomic<std::size_t> next_{0};
+
+    void drain_() {
+        for (std::size_t task; (task = next_.fetch_add(1)) < tasks_;)
+            (*task_)(task);
+    }
+
+    void work_() {
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_)
+                return;
+            seen = generation_;
+            lock.unlock();
+            drain_();
+            lock.lock();
+            if (--busy_ == 0)
+                done_.notify_one();
+        }
+    }
+
+  public:
+    explicit task_pool_t(std::size_t threads) {
+        for (std::size_t i = 0; i < threads; ++i)
+            workers_.emplace_back(&task_pool_t::work_, this);
+    }
+
+    ~task_pool_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker: workers_)
+            worker.join();
+    }
+
+    /// Calls @p task for every number in `[0, count)` and returns once all calls have finished.
+    void for_each(std::size_t count, std::function<void(std::size_t)> const &task) {
+        std::unique_lock<std::mutex> run(run_mutex_, std::try_to_lock);
+        if (!run || workers_.empty() || count < 2) {
+            for (std::size_t i = 0; i != count; ++i)
+                task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            tasks_ = count;
+            next_.store(0);
+            busy_ = workers_.size();
+            ++generation_;
+        }
+        wake_.notify_all();
+        drain_();
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return busy_ == 0; });
+        task_ = nullptr;
+    }
+};
+
+/**
+ *  @brief  What `usearch_sharded_t` points to: independent shards, each a regular index handle,
+ *          and the threads to reach them all at once.
+ */
+struct sharded_handle_t {
+    std::vector<std::unique_ptr<index_handle_t> > shards;
+    std::unique_ptr<task_pool_t> pool;
+
+    /// Spreads keys evenly even when they are sequential, using the SplitMix64 finalizer.
+    std::size_t route(usearch_key_t key) const noexcept {
+        std::uint64_t hash = static_cast<std::uint64_t>(key);
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+        hash ^= hash >> 31;
+        return static_cast<std::size_t>(hash % shards.size());
+    }
+};
+
+sharded_handle_t &sharded_(usearch_sharded_t sharded) { return *reinterpret_cast<sharded_handle_t *>(sharded); }
+
+/**
+ *  @brief  Makes room for @p incoming more vectors. The capacity grows geometrically,
+ *          so a stream of insertions only costs a logarithmic number of reallocations.
+ *
+ *  Growing reallocates the index under exclusive access, which only excludes other operations
+ *  in thread-safe mode. Otherwise the caller must not add while searching or adding elsewhere,
+ *  unless the capacity was reserved ahead.
+ */
+bool grow_(index_handle_t &handle, std::size_t incoming) {
+    index_dense_t &index = handle.index;
+    {
+        shared_access_t access(handle);
+        if (index.size() + incoming <= index.capacity())
+            return true;
+    }
+
+    std::lock_guard<std::mutex> lock(handle.growth_mutex);
+    exclusive_access_t access(handle);
+    std::size_t const needed = index.size() + incoming;
+    std::size_t const capacity = index.capacity();
+    if (needed <= capacity)
+        return true;
+
+    std::size_t grown = static_cast<std::size_t>(static_cast<double>(capacity) * handle.growth_factor);
+    if (grown < capacity + handle.growth_min_step)
+        grown = capacity + handle.growth_min_step;
+    if (grown < needed)
+        grown = needed;
+
+    // Keep the thread limits as they are, `try_reserve(size_t)` would reset them to the hardware defaults.
+    index_limits_t limits = index.limits();
+    limits.members = grown;
+    return index.try_reserve(limits);
+}
+
 add_result_t add_(index_dense_t *index, usearch_key_t key, void const *vector, scalar_kind_t kind) {
     switch (kind) {
         case scalar_kind_t::f32_k: return index->add(key, (f32_t const *) vector);
@@ -117,6 +1162,313 @@ search_result_t search_(index_dense_t *index, void const *vector, scalar_kind_t
     }
 }
 
+add_result_t add_(index_handle_t &handle, usearch_key_t key, void const *vector, scalar_kind_t kind) {
+    stats_probe_t probe(handle.stats);
+    add_result_t result = add_(&handle.index, key, vector, kind);
+    probe.added(result);
+    if (result)
+        changed_(handle);
+    return result;
+}
+
+/// Caps the @p threads a caller asked for, zero meaning as many as possible, at the @p useful ones.
+std::size_t executor_threads_(std::size_t threads, std::size_t useful) noexcept {
+    return threads && threads < useful ? threads : useful;
+}
+
+/// How many threads work that isn't bound to the index's thread contexts can keep busy.
+std::size_t cores_() noexcept {
+    std::size_t const cores = std::thread::hardware_concurrency();
+    return cores ? cores : 1;
+}
+
+/// Tells an insertion that failed because concurrent ones took the room reserved for it.
+bool crowded_(index_handle_t const &handle) { return handle.index.size() >= handle.index.capacity(); }
+
+/**
+ *  @brief  Adds and logs one vector, growing the index first. If concurrent insertions took the
+ *          room reserved for it, grows again and retries, so that only genuine failures surface.
+ */
+usearch_error_t grow_and_add_(index_handle_t &handle, usearch_key_t key, void const *vector,
+                              usearch_scalar_kind_t kind) {
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(kind);
+    for (;;) {
+        change_access_t change(handle);
+        if (!grow_(handle, 1))
+            return "Out of memory!";
+        shared_access_t access(handle);
+        add_result_t result = add_(handle, key, vector, scalar_kind);
+        if (!result && crowded_(handle))
+            continue;
+        if (!result)
+            return result.error.release();
+        std::size_t const length = (handle.index.dimensions() * bits_per_scalar(scalar_kind) + 7) / 8;
+        if (handle.wal && !handle.wal->log_add(key, vector, kind, length))
+            return "Failed to write the log!";
+        return nullptr;
+    }
+}
+
+/**
+ *  @brief  Adds the @p rows of a batch of @p count vectors and logs those that made it in, growing the index first.
+ *          Rows that lost the room reserved for them to concurrent insertions are retried after growing again.
+ */
+usearch_error_t grow_and_add_rows_(index_handle_t &handle, usearch_key_t const *keys, void const *vectors,
+                                   std::size_t count, std::size_t stride, usearch_scalar_kind_t kind,
+                                   std::vector<std::size_t> rows, std::size_t threads) {
+    auto &index_dense = handle.index;
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(kind);
+    std::atomic<usearch_error_t> failure(nullptr);
+    // Rows that made it in are logged even if others failed, so that the log matches the index.
+    std::vector<char> added(handle.wal ? count : 0);
+    for (;;) {
+        change_access_t change(handle);
+        bool const grown = grow_(handle, rows.size());
+        shared_access_t access(handle);
+        std::vector<char> crowded(rows.size());
+        if (!grown) {
+            usearch_error_t expected = nullptr;
+            failure.compare_exchange_strong(expected, "Out of memory!");
+        } else {
+            // Workers pick their contexts from the shared pool, so that concurrent single inserts stay safe,
+            // which is why there is no point in spawning more of them than there are add contexts.
+            std::size_t const contexts = index_dense.limits().threads_add;
+            executor_default_t executor(executor_threads_(threads, contexts));
+            executor.fixed(rows.size(), [&](std::size_t, std::size_t task) {
+                if (failure.load(std::memory_order_relaxed))
+                    return;
+                std::size_t const row = rows[task];
+                add_result_t result = add_(handle, keys[row], (byte_t const *) vectors + row * stride, scalar_kind);
+                if (result) {
+                    if (!added.empty())
+                        added[row] = 1;
+                } else if (crowded_(handle)) {
+                    crowded[task] = 1;
+                } else {
+                    usearch_error_t expected = nullptr;
+                    failure.compare_exchange_strong(expected, result.error.release());
+                }
+            });
+        }
+        std::size_t retried = 0;
+        for (std::size_t task = 0; task != rows.size(); ++task)
+            if (crowded[task])
+                rows[retried++] = rows[task];
+        rows.resize(retried);
+        if (rows.empty() || failure.load()) {
+            std::size_t const length = (index_dense.dimensions() * bits_per_scalar(scalar_kind) + 7) / 8;
+            usearch_error_t expected = nullptr;
+            if (handle.wal && !handle.wal->log_add_batch(keys, vectors, count, stride, kind, length, added))
+                failure.compare_exchange_strong(expected, "Failed to write the log!");
+            break;
+        }
+    }
+    return failure.load();
+}
+
+search_result_t search_(index_handle_t &handle, void const *vector, scalar_kind_t kind, size_t n) {
+    stats_probe_t probe(handle.stats);
+    search_result_t result = search_(&handle.index, vector, kind, n);
+    probe.searched(result);
+    return result;
+}
+
+/// Same as the unfiltered search, also counting the candidates rejected by @p predicate.
+template<typename predicate_at>
+search_result_t search_(index_handle_t &handle, void const *vector, scalar_kind_t kind, size_t n,
+                        predicate_at &&predicate) {
+    stats_probe_t probe(handle.stats);
+    std::size_t filtered = 0;
+    search_result_t result = search_(&handle.index, vector, kind, n, [&](usearch_key_t key) noexcept {
+        bool const admitted = predicate(key);
+        filtered += !admitted;
+        return admitted;
+    });
+    probe.searched(result, filtered);
+    return result;
+}
+
+/**
+ *  @brief  Requests of `usearch_submit_search` and `usearch_submit_add`, answered in micro-batches by a dispatcher
+ *          thread with the help of a `task_pool_t`. The pool lives as long as the queue,
+ *          so a batch costs no thread spawns, and together they never use more threads than asked for.
+ */
+class request_queue_t {
+  public:
+    struct request_t {
+        usearch_searched_t searched = nullptr;
+        usearch_added_t added = nullptr;
+        void *state = nullptr;
+
+        usearch_key_t key = 0;
+        /// Copy of the query or the new vector, in words to keep every scalar kind aligned.
+        std::vector<std::uint64_t> vector;
+        usearch_scalar_kind_t kind = usearch_scalar_unknown_k;
+        std::size_t bytes = 0;
+
+        std::vector<usearch_key_t> keys;
+        std::vector<usearch_distance_t> distances;
+        std::size_t found = 0;
+        usearch_error_t error = nullptr;
+    };
+
+  private:
+    index_handle_t &owner_;
+    std::size_t const depth_;
+    std::size_t const batch_;
+    task_pool_t pool_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<request_t> pending_;
+    bool stopping_ = false;
+    /// Declared last, so that it starts once everything else is ready.
+    std::thread dispatcher_;
+
+    void answer_(std::vector<request_t> &batch) {
+        std::size_t const adds = static_cast<std::size_t>(
+            std::count_if(batch.begin(), batch.end(), [](request_t const &request) { return request.added; }));
+        std::vector<char> crowded(batch.size());
+        {
+            change_access_t change(owner_, adds != 0);
+            bool const grown = !adds || grow_(owner_, adds);
+            shared_access_t access(owner_);
+            pool_.for_each(batch.size(), [&](std::size_t task) {
+                request_t &request = batch[task];
+                scalar_kind_t const kind = scalar_kind_to_cpp(request.kind);
+                if (request.searched) {
+                    search_result_t result = search_(owner_, request.vector.data(), kind, request.keys.size());
+                    if (!result)
+                        request.error = result.error.release();
+                    else
+                        request.found = result.dump_to(request.keys.data(), request.distances.data());
+                    return;
+                }
+                if (!grown) {
+                    request.error = "Out of memory!";
+                    return;
+                }
+                add_result_t result = add_(owner_, request.key, request.vector.data(), kind);
+                if (!result && crowded_(owner_))
+                    crowded[task] = 1;
+                else if (!result)
+                    request.error = result.error.release();
+                else if (owner_.wal &&
+                         !owner_.wal->log_add(request.key, request.vector.data(), request.kind, request.bytes))
+                    request.error = "Failed to write the log!";
+            });
+        }
+        // Adds that lost their room to concurrent insertions are retried one by one, growing as needed.
+        for (std::size_t task = 0; task != batch.size(); ++task) {
+            request_t &request = batch[task];
+            if (crowded[task])
+                request.error = grow_and_add_(owner_, request.key, request.vector.data(), request.kind);
+        }
+    }
+
+    void dispatch_() {
+        std::vector<request_t> batch;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+            if (pending_.empty())
+                return;
+            std::size_t const taken = (std::min)(batch_, pending_.size());
+            std::move(pending_.begin(), pending_.begin() + taken, std::back_inserter(batch));
+            pending_.erase(pending_.begin(), pending_.begin() + taken);
+            lock.unlock();
+
+            answer_(batch);
+            // The index is released by now, so completions may call back into it, or submit the next request.
+            for (request_t const &request: batch) {
+                if (request.searched)
+                    request.searched(request.keys.data(), request.distances.data(), request.found, request.error,
+                                     request.state);
+                else
+                    request.added(request.error, request.state);
+            }
+            batch.clear();
+            lock.lock();
+        }
+    }
+
+  public:
+    request_queue_t(index_handle_t &owner, std::size_t depth, std::size_t batch, std::size_t threads)
+        : owner_(owner), depth_(depth), batch_(batch), pool_(threads - 1), dispatcher_(&request_queue_t::dispatch_, this) {}
+
+    ~request_queue_t() {
+        stop();
+        dispatcher_.join();
+    }
+
+    /// Lets the dispatcher exit once the pending requests are answered, without waiting for it.
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+    }
+
+    /// Tells whether the caller runs on the dispatcher, i.e. within a completion, where the queue can't be joined.
+    bool dispatching() const { return std::this_thread::get_id() == dispatcher_.get_id(); }
+
+    /// Copies @p vector into @p request and queues it, unless `depth` requests are already pending.
+    bool submit(request_t &&request, void const *vector) {
+        std::size_t const bits = owner_.index.dimensions() * bits_per_scalar(scalar_kind_to_cpp(request.kind));
+        request.bytes = (bits + 7) / 8;
+        request.vector.resize((request.bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+        std::memcpy(request.vector.data(), vector, request.bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_.size() >= depth_)
+                return false;
+            pending_.push_back(std::move(request));
+        }
+        wake_.notify_one();
+        return true;
+    }
+};
+
+/**
+ *  @brief  Collects the neighbors within @p max_distance of the query, up to @p max_results of them.
+ *          The graph has no notion of a radius, so rounds of top-k searches double `k` for as long as the farthest
+ *          match is still within the radius. The work is thus proportional to the number of matches,
+ *          rather than to `max_results`.
+ *  @return Number of matches written to @p keys and @p distances, which have room for @p max_results each.
+ */
+std::size_t range_search_(index_handle_t &handle, void const *query, scalar_kind_t kind, usearch_distance_t max_distance,
+                          std::size_t max_results, usearch_key_t *keys, usearch_distance_t *distances,
+                          usearch_error_t *error) {
+    std::size_t limit = (std::min)(range_search_initial_k, max_results);
+    while (limit) {
+        search_result_t result = search_(handle, query, kind, limit);
+        if (!result) {
+            *error = result.error.release();
+            return 0;
+        }
+        std::size_t const found = result.dump_to(keys, distances);
+        if (found < limit || distances[found - 1] > max_distance || limit == max_results)
+            return static_cast<std::size_t>(std::upper_bound(distances, distances + found, max_distance) - distances);
+        limit = (std::min)(limit * 2, max_results);
+    }
+    return 0;
+}
+
+template<typename set_at>
+size_t search_filtered_(usearch_index_t index, void const *query, scalar_kind_t kind, size_t results_limit,
+                        set_at const &set, bool exclude,
+                        usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
+    search_result_t result = search_(handle_(index), query, kind, results_limit,
+                                     [&set, exclude](usearch_key_t key) noexcept { return set.contains(key) != exclude; });
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    return result.dump_to(found_keys, found_distances);
+}
+
 extern "C" {
 USEARCH_EXPORT char const *usearch_version(void) {
     int major = USEARCH_VERSION_MAJOR;
@@ -133,7 +1485,7 @@ USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t *options, use
     // The user may want to initialize from a file.
     // In that case he may pass NULL options, and we will try to load the metadata from the file.
     if (!options) {
-        index_dense_t *result_ptr = new index_dense_t();
+        index_handle_t *result_ptr = new index_handle_t();
         if (!result_ptr)
             *error = "Out of memory!";
         return result_ptr;
@@ -144,7 +1496,7 @@ USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t *options, use
     config.expansion_add = options->expansion_add;
     config.expansion_search = options->expansion_search;
     config.multi = options->multi;
-    config.enable_key_lookups = 1;
+    config.enable_key_lookups = options->key_lookups == usearch_key_lookups_hash_k;
 
     metric_kind_t metric_kind = metric_kind_to_cpp(options->metric_kind);
     scalar_kind_t scalar_kind = scalar_kind_to_cpp(options->quantization);
@@ -164,45 +1516,116 @@ USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t *options, use
     state_result_t state = index_dense_t::make(metric, config);
     if (!state)
         *error = state.error.release();
-    index_dense_t *result_ptr = new index_dense_t(std::move(state.index));
+    index_handle_t *result_ptr = new index_handle_t(std::move(state.index));
     if (!result_ptr)
         *error = "Out of memory!";
+    result_ptr->thread_safe = options->thread_safe;
+    result_ptr->key_lookups = options->key_lookups;
 
     // Let's immediately make it usable by reserving enough threads for this machine:
-    if (!result_ptr->try_reserve(index_limits_t()))
+    if (!result_ptr->index.try_reserve(index_limits_t()))
         *error = "Out of memory when preparing contexts!";
 
     return result_ptr;
 }
 
 USEARCH_EXPORT void usearch_free(usearch_index_t index, usearch_error_t *) {
-    delete reinterpret_cast<index_dense_t *>(index);
+    delete reinterpret_cast<index_handle_t *>(index);
 }
 
 USEARCH_EXPORT size_t usearch_serialized_length(usearch_index_t index, usearch_error_t *) {
     USEARCH_ASSERT(index && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->serialized_length();
+    shared_access_t access(index);
+    return dense_(index)->serialized_length();
 }
 
 USEARCH_EXPORT void usearch_save(usearch_index_t index, char const *path, usearch_error_t *error) {
     USEARCH_ASSERT(index && path && error && "Missing arguments");
-    serialization_result_t result = reinterpret_cast<index_dense_t *>(index)->save(path);
+    exclusive_access_t access(index);
+    serialization_result_t result = dense_(index)->save(path);
     if (!result)
         *error = result.error.release();
 }
 
 USEARCH_EXPORT void usearch_load(usearch_index_t index, char const *path, usearch_error_t *error) {
     USEARCH_ASSERT(index && path && error && "Missing arguments");
-    serialization_result_t result = reinterpret_cast<index_dense_t *>(index)->load(path);
+    exclusive_access_t access(index);
+    serialization_result_t result = dense_(index)->load(path);
+    changed_(handle_(index));
     if (!result)
         *error = result.error.release();
+    else
+        handle_(index).arena.reset();
+}
+
+USEARCH_EXPORT void usearch_save_stream(usearch_index_t index, usearch_write_t write, void *state,
+                                        usearch_error_t *error) {
+    USEARCH_ASSERT(index && write && error && "Missing arguments");
+    exclusive_access_t access(index);
+    chunked_output_t output(write, state);
+    serialization_result_t result = dense_(index)->save_to_stream(output);
+    if (!result)
+        *error = result.error.release();
+    else if (!output.flush())
+        *error = "Failed to write the last chunk!";
+}
+
+USEARCH_EXPORT void usearch_load_stream(usearch_index_t index, usearch_read_t read, void *state,
+                                        usearch_error_t *error) {
+    USEARCH_ASSERT(index && read && error && "Missing arguments");
+    exclusive_access_t access(index);
+    serialization_result_t result = dense_(index)->load_from_stream(
+            [=](void *data, std::size_t length) { return read(data, length, state); });
+    changed_(handle_(index));
+    if (!result)
+        *error = result.error.release();
+    else
+        handle_(index).arena.reset();
 }
 
 USEARCH_EXPORT void usearch_view(usearch_index_t index, char const *path, usearch_error_t *error) {
     USEARCH_ASSERT(index && path && error && "Missing arguments");
-    serialization_result_t result = reinterpret_cast<index_dense_t *>(index)->view(path);
+    exclusive_access_t access(index);
+    serialization_result_t result = dense_(index)->view(path);
+    changed_(handle_(index));
+    if (!result)
+        *error = result.error.release();
+    else
+        handle_(index).arena.reset();
+}
+
+USEARCH_EXPORT void usearch_view_file(usearch_index_t index, char const *path, usearch_view_advice_t advice,
+                                      usearch_error_t *error) {
+    USEARCH_ASSERT(index && path && error && "Missing arguments");
+    exclusive_access_t access(index);
+    memory_mapped_file_t file(path);
+    serialization_result_t result = file.open_if_not();
+    if (!result) {
+        *error = result.error.release();
+        return;
+    }
+
+#if !defined(_WIN32)
+    // The index takes over the mapping below, but its address stays the same, so advise it beforehand.
+    int native_advice = MADV_NORMAL;
+    switch (advice) {
+        case usearch_view_random_k: native_advice = MADV_RANDOM; break;
+        case usearch_view_sequential_k: native_advice = MADV_SEQUENTIAL; break;
+        case usearch_view_willneed_k: native_advice = MADV_WILLNEED; break;
+        default: break;
+    }
+    // Failing to advise only costs performance, so the result is deliberately ignored.
+    (void)::madvise(file.data(), file.size(), native_advice);
+#else
+    (void)advice;
+#endif
+
+    result = dense_(index)->view(std::move(file));
+    changed_(handle_(index));
     if (!result)
         *error = result.error.release();
+    else
+        handle_(index).arena.reset();
 }
 
 USEARCH_EXPORT void usearch_metadata(char const *path, usearch_init_options_t *options, usearch_error_t *error) {
@@ -215,6 +1638,8 @@ USEARCH_EXPORT void usearch_metadata(char const *path, usearch_init_options_t *o
     options->quantization = scalar_kind_to_c(result.head.kind_scalar);
     options->dimensions = result.head.dimensions;
     options->multi = result.head.multi;
+    options->thread_safe = false;
+    options->key_lookups = usearch_key_lookups_hash_k;
 
     options->connectivity = 0;
     options->expansion_add = 0;
@@ -224,8 +1649,9 @@ USEARCH_EXPORT void usearch_metadata(char const *path, usearch_init_options_t *o
 
 USEARCH_EXPORT void usearch_save_buffer(usearch_index_t index, void *buffer, size_t length, usearch_error_t *error) {
     USEARCH_ASSERT(index && buffer && length && error && "Missing arguments");
+    exclusive_access_t access(index);
     memory_mapped_file_t memory_map((byte_t *) buffer, length);
-    serialization_result_t result = reinterpret_cast<index_dense_t *>(index)->save(std::move(memory_map));
+    serialization_result_t result = dense_(index)->save(std::move(memory_map));
     if (!result)
         *error = result.error.release();
 }
@@ -233,19 +1659,53 @@ USEARCH_EXPORT void usearch_save_buffer(usearch_index_t index, void *buffer, siz
 USEARCH_EXPORT void usearch_load_buffer(usearch_index_t index, void const *buffer, size_t length,
                                         usearch_error_t *error) {
     USEARCH_ASSERT(index && buffer && length && error && "Missing arguments");
+    exclusive_access_t access(index);
     memory_mapped_file_t memory_map((byte_t *) buffer, length);
-    serialization_result_t result = reinterpret_cast<index_dense_t *>(index)->load(std::move(memory_map));
+    serialization_result_t result = dense_(index)->load(std::move(memory_map));
+    changed_(handle_(index));
     if (!result)
         *error = result.error.release();
+    else
+        handle_(index).arena.reset();
+}
+
+USEARCH_EXPORT void usearch_load_huge_pages(usearch_index_t index, char const *path, usearch_error_t *error) {
+    USEARCH_ASSERT(index && path && error && "Missing arguments");
+    exclusive_access_t access(index);
+    memory_mapped_file_t file(path);
+    serialization_result_t result = file.open_if_not();
+    if (!result) {
+        *error = result.error.release();
+        return;
+    }
+
+    std::unique_ptr<huge_page_arena_t> arena(new huge_page_arena_t());
+    if (!arena->allocate(file.size())) {
+        *error = "Out of memory!";
+        return;
+    }
+    std::memcpy(arena->data(), file.data(), file.size());
+    result = dense_(index)->view(memory_mapped_file_t(arena->data(), file.size()));
+    changed_(handle_(index));
+    if (!result) {
+        *error = result.error.release();
+        return;
+    }
+    // The previous arena is only freed now, as the index no longer refers to it.
+    handle_(index).arena = std::move(arena);
 }
 
 USEARCH_EXPORT void usearch_view_buffer(usearch_index_t index, void const *buffer, size_t length,
                                         usearch_error_t *error) {
     USEARCH_ASSERT(index && buffer && length && error && "Missing arguments");
+    exclusive_access_t access(index);
     memory_mapped_file_t memory_map((byte_t *) buffer, length);
-    serialization_result_t result = reinterpret_cast<index_dense_t *>(index)->view(std::move(memory_map));
+    serialization_result_t result = dense_(index)->view(std::move(memory_map));
+    changed_(handle_(index));
     if (!result)
         *error = result.error.release();
+    else
+        handle_(index).arena.reset();
 }
 
 USEARCH_EXPORT void usearch_metadata_buffer(void const *buffer, size_t length, usearch_init_options_t *options,
@@ -260,6 +1720,8 @@ USEARCH_EXPORT void usearch_metadata_buffer(void const *buffer, size_t length, u
     options->quantization = scalar_kind_to_c(result.head.kind_scalar);
     options->dimensions = result.head.dimensions;
     options->multi = result.head.multi;
+    options->thread_safe = false;
+    options->key_lookups = usearch_key_lookups_hash_k;
 
     options->connectivity = 0;
     options->expansion_add = 0;
@@ -269,57 +1731,139 @@ USEARCH_EXPORT void usearch_metadata_buffer(void const *buffer, size_t length, u
 
 USEARCH_EXPORT size_t usearch_size(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->size();
+    shared_access_t access(index);
+    return dense_(index)->size();
 }
 
 USEARCH_EXPORT size_t usearch_capacity(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->capacity();
+    shared_access_t access(index);
+    return dense_(index)->capacity();
+}
+
+USEARCH_EXPORT size_t usearch_tombstones(usearch_index_t index, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    shared_access_t access(index);
+    // Removed entries keep their nodes until compaction, so the graph holds more nodes than the index has vectors.
+    auto &index_dense = *dense_(index);
+    std::size_t const nodes = index_dense.stats().nodes;
+    std::size_t const size = index_dense.size();
+    return nodes > size ? nodes - size : 0;
+}
+
+USEARCH_EXPORT void usearch_enable_stats(usearch_index_t index, bool enabled, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    if (!handle_(index).stats.enable(enabled))
+        *error = "Out of memory!";
+}
+
+USEARCH_EXPORT void usearch_stats(usearch_index_t index, usearch_stats_t *stats, usearch_error_t *error) {
+    USEARCH_ASSERT(index && stats && error && "Missing arguments");
+    handle_(index).stats.export_to(*stats);
+}
+
+USEARCH_EXPORT void usearch_reset_stats(usearch_index_t index, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    handle_(index).stats.reset();
+}
+
+USEARCH_EXPORT void usearch_enable_cache(usearch_index_t index, size_t capacity, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    auto &handle = handle_(index);
+    exclusive_access_t access(handle);
+    if (!capacity) {
+        handle.cache.reset();
+        return;
+    }
+    handle.cache.reset(new (std::nothrow) query_cache_t(capacity));
+    if (!handle.cache)
+        *error = "Out of memory!";
+}
+
+USEARCH_EXPORT void usearch_cache_stats(usearch_index_t index, usearch_cache_stats_t *stats, usearch_error_t *error) {
+    USEARCH_ASSERT(index && stats && error && "Missing arguments");
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    if (handle.cache)
+        handle.cache->export_to(*stats);
+    else
+        std::memset(stats, 0, sizeof(*stats));
 }
 
 USEARCH_EXPORT size_t usearch_dimensions(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->dimensions();
+    shared_access_t access(index);
+    return dense_(index)->dimensions();
 }
 
 USEARCH_EXPORT size_t usearch_connectivity(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->connectivity();
+    shared_access_t access(index);
+    return dense_(index)->connectivity();
 }
 
 USEARCH_EXPORT size_t usearch_expansion_add(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->expansion_add();
+    shared_access_t access(index);
+    return dense_(index)->expansion_add();
 }
 
 USEARCH_EXPORT size_t usearch_expansion_search(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->expansion_search();
+    shared_access_t access(index);
+    return dense_(index)->expansion_search();
 }
 
 USEARCH_EXPORT size_t usearch_memory_usage(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->memory_usage();
+    shared_access_t access(index);
+    auto &handle = handle_(index);
+    return handle.index.memory_usage() + (handle.arena ? handle.arena->size() : 0);
+}
+
+USEARCH_EXPORT void usearch_memory_breakdown(usearch_index_t index, usearch_memory_breakdown_t *breakdown,
+                                             usearch_error_t *error) {
+    USEARCH_ASSERT(index && breakdown && error && "Missing arguments");
+    shared_access_t access(index);
+    auto &handle = handle_(index);
+    index_dense_t const &dense = handle.index;
+    breakdown->graph = dense.stats().allocated_bytes;
+    breakdown->vectors = dense.size() * dense.bytes_per_vector();
+    // The table is reserved for the whole capacity, holding a key and a slot per member.
+    breakdown->lookup = handle.key_lookups != usearch_key_lookups_hash_k
+                            ? 0
+                            : dense.capacity() * (sizeof(usearch_key_t) + sizeof(index_dense_t::compressed_slot_t));
+    breakdown->huge_pages = handle.arena ? handle.arena->size() : 0;
+    breakdown->total = dense.memory_usage() + breakdown->huge_pages;
+
+    std::size_t accounted = breakdown->lookup + breakdown->huge_pages;
+    if (!handle.arena && !dense.is_immutable())
+        accounted += breakdown->graph + breakdown->vectors;
+    breakdown->other = breakdown->total > accounted ? breakdown->total - accounted : 0;
 }
 
 USEARCH_EXPORT char const *usearch_hardware_acceleration(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->metric().isa_name();
+    shared_access_t access(index);
+    return dense_(index)->metric().isa_name();
 }
 
 USEARCH_EXPORT void usearch_change_expansion_add(usearch_index_t index, size_t expansion, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    reinterpret_cast<index_dense_t *>(index)->change_expansion_add(expansion);
+    exclusive_access_t access(index);
+    dense_(index)->change_expansion_add(expansion);
 }
 
 USEARCH_EXPORT void usearch_change_expansion_search(usearch_index_t index, size_t expansion, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    reinterpret_cast<index_dense_t *>(index)->change_expansion_search(expansion);
+    exclusive_access_t access(index);
+    dense_(index)->change_expansion_search(expansion);
 }
 
 USEARCH_EXPORT void usearch_change_threads_add(usearch_index_t index, size_t threads, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    auto &index_dense = *reinterpret_cast<index_dense_t *>(index);
+    exclusive_access_t access(index);
+    auto &index_dense = *dense_(index);
     index_limits_t limits = index_dense.limits();
     limits.threads_add = threads;
     index_dense.try_reserve(limits);
@@ -327,7 +1871,8 @@ USEARCH_EXPORT void usearch_change_threads_add(usearch_index_t index, size_t thr
 
 USEARCH_EXPORT void usearch_change_threads_search(usearch_index_t index, size_t threads, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    auto &index_dense = *reinterpret_cast<index_dense_t *>(index);
+    exclusive_access_t access(index);
+    auto &index_dense = *dense_(index);
     index_limits_t limits = index_dense.limits();
     limits.threads_search = threads;
     index_dense.try_reserve(limits);
@@ -336,15 +1881,18 @@ USEARCH_EXPORT void usearch_change_threads_search(usearch_index_t index, size_t
 USEARCH_EXPORT void usearch_change_metric_kind(usearch_index_t index, usearch_metric_kind_t kind,
                                                usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    auto &index_dense = *reinterpret_cast<index_dense_t *>(index);
+    exclusive_access_t access(index);
+    auto &index_dense = *dense_(index);
     index_dense.change_metric(
         metric_punned_t::builtin(index_dense.dimensions(), metric_kind_to_cpp(kind), index_dense.scalar_kind()));
+    changed_(handle_(index));
 }
 
 USEARCH_EXPORT void usearch_change_metric(usearch_index_t index, usearch_metric_t metric, void *state,
                                           usearch_metric_kind_t kind, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    auto &index_dense = *reinterpret_cast<index_dense_t *>(index);
+    exclusive_access_t access(index);
+    auto &index_dense = *dense_(index);
     auto metric_punned =
             state
                 ? metric_punned_t::stateful(index_dense.dimensions(), reinterpret_cast<std::uintptr_t>(metric),
@@ -354,45 +1902,275 @@ USEARCH_EXPORT void usearch_change_metric(usearch_index_t index, usearch_metric_
                                              metric_punned_signature_t::array_array_k, metric_kind_to_cpp(kind),
                                              index_dense.scalar_kind());
     index_dense.change_metric(std::move(metric_punned));
+    changed_(handle_(index));
 }
 
 USEARCH_EXPORT void usearch_reserve(usearch_index_t index, size_t capacity, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    if (!reinterpret_cast<index_dense_t *>(index)->try_reserve(capacity))
+    exclusive_access_t access(index);
+    auto &index_dense = *dense_(index);
+    index_limits_t limits = index_dense.limits();
+    limits.members = capacity;
+    if (!index_dense.try_reserve(limits))
         *error = "Out of memory!";
 }
 
+USEARCH_EXPORT void usearch_change_growth_policy(usearch_index_t index, float factor, size_t min_step,
+                                                 usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    if (!(factor >= 1) || !min_step) {
+        *error = "Growth factor must be at least 1 and the step must be positive!";
+        return;
+    }
+    auto &handle = handle_(index);
+    std::lock_guard<std::mutex> lock(handle.growth_mutex);
+    handle.growth_factor = factor;
+    handle.growth_min_step = min_step;
+}
+
 USEARCH_EXPORT void usearch_add( //
     usearch_index_t index, usearch_key_t key, void const *vector, usearch_scalar_kind_t kind, //
     usearch_error_t *error) {
     USEARCH_ASSERT(index && vector && error && "Missing arguments");
-    add_result_t result = add_(reinterpret_cast<index_dense_t *>(index), key, vector, scalar_kind_to_cpp(kind));
-    if (!result)
-        *error = result.error.release();
+    if (usearch_error_t failure = grow_and_add_(handle_(index), key, vector, kind))
+        *error = failure;
 }
 
-USEARCH_EXPORT bool usearch_contains(usearch_index_t index, usearch_key_t key, usearch_error_t *) {
-    USEARCH_ASSERT(index && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->contains(key);
+USEARCH_EXPORT void usearch_add_batch( //
+    usearch_index_t index, usearch_key_t const *keys, //
+    void const *vectors, size_t count, size_t stride, //
+    usearch_scalar_kind_t kind, size_t threads, usearch_error_t *error) {
+    USEARCH_ASSERT(index && keys && vectors && error && "Missing arguments");
+    std::vector<std::size_t> rows(count);
+    std::iota(rows.begin(), rows.end(), std::size_t(0));
+    usearch_error_t failure =
+            grow_and_add_rows_(handle_(index), keys, vectors, count, stride, kind, std::move(rows), threads);
+    if (failure)
+        *error = failure;
 }
 
-USEARCH_EXPORT size_t usearch_count(usearch_index_t index, usearch_key_t key, usearch_error_t *) {
-    USEARCH_ASSERT(index && "Missing arguments");
-    return reinterpret_cast<index_dense_t *>(index)->count(key);
+USEARCH_EXPORT bool usearch_contains(usearch_index_t index, usearch_key_t key, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    // Identity keys are the slots themselves, so every slot below the size is taken.
+    if (handle.key_lookups == usearch_key_lookups_identity_k)
+        return key < handle.index.size();
+    if (!has_key_lookups_(handle, error))
+        return false;
+    return handle.index.contains(key);
+}
+
+USEARCH_EXPORT size_t usearch_count(usearch_index_t index, usearch_key_t key, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    if (!has_key_lookups_(handle, error))
+        return 0;
+    return handle.index.count(key);
 }
 
 USEARCH_EXPORT size_t usearch_search( //
     usearch_index_t index, void const *query, usearch_scalar_kind_t query_kind, size_t results_limit, //
     usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
     USEARCH_ASSERT(index && query && error && "Missing arguments");
-    search_result_t result =
-            search_(reinterpret_cast<index_dense_t *>(index), query, scalar_kind_to_cpp(query_kind), results_limit);
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(query_kind);
+    query_cache_t *cache = handle.cache.get();
+    std::size_t const query_bytes = (handle.index.dimensions() * bits_per_scalar(scalar_kind) + 7) / 8;
+    if (!query_bytes)
+        cache = nullptr;
+
+    // The version is read before searching, so that results racing with a change are cached as stale.
+    std::size_t const version = handle.version.load(std::memory_order_acquire);
+    query_cache_t::query_t const cached((byte_t const *) query, cache ? query_bytes : 0, query_kind, results_limit,
+                                        handle.index.expansion_search());
+    std::size_t found = 0;
+    if (cache && cache->find(cached, version, found_keys, found_distances, found))
+        return found;
+
+    search_result_t result = search_(handle, query, scalar_kind, results_limit);
     if (!result) {
         *error = result.error.release();
         return 0;
     }
 
-    return result.dump_to(found_keys, found_distances);
+    found = result.dump_to(found_keys, found_distances);
+    if (cache)
+        cache->insert(cached, version, found_keys, found_distances, found);
+    return found;
+}
+
+USEARCH_EXPORT size_t usearch_range_search( //
+    usearch_index_t index, void const *query, usearch_scalar_kind_t query_kind, //
+    usearch_distance_t max_distance, size_t max_results, //
+    usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
+    USEARCH_ASSERT(index && query && found_keys && found_distances && error && "Missing arguments");
+    shared_access_t access(index);
+    return range_search_(handle_(index), query, scalar_kind_to_cpp(query_kind), max_distance, max_results,
+                         found_keys, found_distances, error);
+}
+
+USEARCH_EXPORT size_t usearch_search_grouped( //
+    usearch_index_t index, void const *query, usearch_scalar_kind_t query_kind, size_t count, //
+    usearch_aggregation_t aggregation, size_t top_m, //
+    usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
+    USEARCH_ASSERT(index && query && found_keys && found_distances && error && "Missing arguments");
+    if (aggregation != usearch_aggregation_min_k && aggregation != usearch_aggregation_mean_k &&
+        aggregation != usearch_aggregation_top_sum_k) {
+        *error = "Unknown aggregation!";
+        return 0;
+    }
+    if (aggregation == usearch_aggregation_top_sum_k && !top_m) {
+        *error = "Summing needs at least one distance per key!";
+        return 0;
+    }
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(query_kind);
+
+    struct group_t {
+        usearch_key_t key;
+        usearch_distance_t distance;
+        std::size_t members;
+    };
+    std::vector<usearch_key_t> keys;
+    std::vector<usearch_distance_t> distances;
+    std::vector<group_t> groups;
+    std::unordered_map<usearch_key_t, std::size_t> group_of;
+    std::size_t const size = handle.index.size();
+    std::size_t limit = (std::min)(count * grouped_search_oversample_k, size);
+    std::size_t found = 0;
+    while (limit) {
+        keys.resize(limit);
+        distances.resize(limit);
+        search_result_t result = search_(handle, query, scalar_kind, limit);
+        if (!result) {
+            *error = result.error.release();
+            return 0;
+        }
+        found = result.dump_to(keys.data(), distances.data());
+
+        // Candidates come closest first, so the first vector of every key is its closest one.
+        groups.clear();
+        group_of.clear();
+        for (std::size_t i = 0; i != found; ++i) {
+            auto inserted = group_of.emplace(keys[i], groups.size());
+            if (inserted.second) {
+                groups.push_back({keys[i], distances[i], 1});
+                continue;
+            }
+            group_t &group = groups[inserted.first->second];
+            ++group.members;
+            if (aggregation == usearch_aggregation_mean_k ||
+                (aggregation == usearch_aggregation_top_sum_k && group.members <= top_m))
+                group.distance += distances[i];
+        }
+        if (groups.size() >= count || found < limit || limit == size)
+            break;
+        limit = (std::min)(limit * 2, size);
+    }
+
+    if (aggregation == usearch_aggregation_mean_k)
+        for (group_t &group: groups)
+            group.distance /= static_cast<usearch_distance_t>(group.members);
+    // Vectors of a key beyond the candidates are at least as far as the farthest candidate,
+    // so a key with fewer than `top_m` candidates can't win just by having fewer terms.
+    if (aggregation == usearch_aggregation_top_sum_k && found)
+        for (group_t &group: groups)
+            if (group.members < top_m)
+                group.distance += static_cast<usearch_distance_t>(top_m - group.members) * distances[found - 1];
+    std::size_t const returned = (std::min)(count, groups.size());
+    std::partial_sort(groups.begin(), groups.begin() + returned, groups.end(),
+                      [](group_t const &a, group_t const &b) { return a.distance < b.distance; });
+    for (std::size_t i = 0; i != returned; ++i) {
+        found_keys[i] = groups[i].key;
+        found_distances[i] = groups[i].distance;
+    }
+    return returned;
+}
+
+USEARCH_EXPORT size_t usearch_range_search_batch( //
+    usearch_index_t index, //
+    void const *queries, usearch_scalar_kind_t query_kind, size_t queries_count, size_t queries_stride, //
+    usearch_distance_t max_distance, size_t max_results, size_t threads, //
+    usearch_key_t *found_keys, size_t keys_stride, //
+    usearch_distance_t *found_distances, size_t distances_stride, //
+    size_t *found_counts, usearch_error_t *error) {
+    USEARCH_ASSERT(index && queries && found_keys && found_distances && found_counts && error && "Missing arguments");
+    shared_access_t access(index);
+    auto &handle = handle_(index);
+
+    std::size_t const contexts = handle.index.limits().threads_search;
+    executor_default_t executor(executor_threads_(threads, contexts));
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(query_kind);
+    std::atomic<usearch_error_t> failure(nullptr);
+    std::atomic<std::size_t> found(0);
+    executor.fixed(queries_count, [&](std::size_t, std::size_t task) {
+        found_counts[task] = 0;
+        if (failure.load(std::memory_order_relaxed))
+            return;
+        usearch_error_t task_error = nullptr;
+        found_counts[task] = range_search_( //
+            handle, (byte_t const *) queries + task * queries_stride, scalar_kind, max_distance, max_results,
+            (usearch_key_t *) ((byte_t *) found_keys + task * keys_stride),
+            (usearch_distance_t *) ((byte_t *) found_distances + task * distances_stride), &task_error);
+        if (task_error) {
+            usearch_error_t expected = nullptr;
+            failure.compare_exchange_strong(expected, task_error);
+            return;
+        }
+        found.fetch_add(found_counts[task], std::memory_order_relaxed);
+    });
+    if (failure.load()) {
+        *error = failure.load();
+        return 0;
+    }
+
+    return found.load();
+}
+
+USEARCH_EXPORT size_t usearch_search_batch( //
+    usearch_index_t index, //
+    void const *queries, usearch_scalar_kind_t query_kind, size_t queries_count, size_t queries_stride, //
+    size_t results_limit, size_t threads, //
+    usearch_key_t *found_keys, size_t keys_stride, //
+    usearch_distance_t *found_distances, size_t distances_stride, //
+    size_t *found_counts, usearch_error_t *error) {
+    USEARCH_ASSERT(index && queries && found_keys && found_distances && found_counts && error && "Missing arguments");
+    shared_access_t access(index);
+    auto &handle = handle_(index);
+    auto &index_dense = handle.index;
+
+    // Same as with batch insertions, the pool of search contexts bounds the useful parallelism.
+    std::size_t const contexts = index_dense.limits().threads_search;
+    executor_default_t executor(executor_threads_(threads, contexts));
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(query_kind);
+    std::atomic<usearch_error_t> failure(nullptr);
+    std::atomic<std::size_t> found(0);
+    executor.fixed(queries_count, [&](std::size_t, std::size_t task) {
+        found_counts[task] = 0;
+        if (failure.load(std::memory_order_relaxed))
+            return;
+        search_result_t result =
+                search_(handle, (byte_t const *) queries + task * queries_stride, scalar_kind, results_limit);
+        if (!result) {
+            usearch_error_t expected = nullptr;
+            failure.compare_exchange_strong(expected, result.error.release());
+            return;
+        }
+        found_counts[task] = result.dump_to( //
+            (usearch_key_t *) ((byte_t *) found_keys + task * keys_stride),
+            (usearch_distance_t *) ((byte_t *) found_distances + task * distances_stride));
+        found.fetch_add(found_counts[task], std::memory_order_relaxed);
+    });
+    if (failure.load()) {
+        *error = failure.load();
+        return 0;
+    }
+
+    return found.load();
 }
 
 USEARCH_EXPORT size_t usearch_filtered_search( //
@@ -401,8 +2179,9 @@ USEARCH_EXPORT size_t usearch_filtered_search( //
     int (*filter)(usearch_key_t key, void *filter_state), void *filter_state, //
     usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
     USEARCH_ASSERT(index && query && filter && error && "Missing arguments");
+    shared_access_t access(index);
     search_result_t result =
-            search_(reinterpret_cast<index_dense_t *>(index), query, scalar_kind_to_cpp(query_kind), results_limit,
+            search_(handle_(index), query, scalar_kind_to_cpp(query_kind), results_limit,
                     [=](usearch_key_t key) noexcept { return filter(key, filter_state); });
     if (!result) {
         *error = result.error.release();
@@ -412,27 +2191,245 @@ USEARCH_EXPORT size_t usearch_filtered_search( //
     return result.dump_to(found_keys, found_distances);
 }
 
+USEARCH_EXPORT usearch_filter_t usearch_filter_init( //
+    usearch_filter_kind_t kind, usearch_key_t const *keys, size_t count, bool exclude, usearch_error_t *error) {
+    USEARCH_ASSERT((keys || !count) && error && "Missing arguments");
+    if (kind != usearch_filter_bitset_k && kind != usearch_filter_sorted_k && kind != usearch_filter_hash_k) {
+        *error = "Unknown filter kind!";
+        return nullptr;
+    }
+
+    std::unique_ptr<key_filter_t> filter(new key_filter_t());
+    filter->kind = kind;
+    filter->exclude = exclude;
+    if (kind == usearch_filter_hash_k) {
+        filter->hashed.reserve(count);
+        filter->hashed.insert(keys, keys + count);
+        return filter.release();
+    }
+
+    filter->sorted.assign(keys, keys + count);
+    std::sort(filter->sorted.begin(), filter->sorted.end());
+    filter->sorted.erase(std::unique(filter->sorted.begin(), filter->sorted.end()), filter->sorted.end());
+    if (kind == usearch_filter_bitset_k) {
+        filter->bitset.reset(new key_bitset_t(filter->sorted));
+        std::vector<usearch_key_t>().swap(filter->sorted);
+    }
+    return filter.release();
+}
+
+USEARCH_EXPORT void usearch_filter_free(usearch_filter_t filter, usearch_error_t *) {
+    delete reinterpret_cast<key_filter_t *>(filter);
+}
+
+USEARCH_EXPORT usearch_store_t usearch_store_map_file( //
+    char const *path, usearch_scalar_kind_t kind, size_t dimensions, usearch_error_t *error) {
+    USEARCH_ASSERT(path && error && "Missing arguments");
+    std::size_t const row_bytes = (dimensions * bits_per_scalar(scalar_kind_to_cpp(kind)) + 7) / 8;
+    if (!row_bytes) {
+        *error = "Unknown scalar kind!";
+        return nullptr;
+    }
+
+    std::unique_ptr<vector_store_t> store(new vector_store_t());
+    store->kind = scalar_kind_to_cpp(kind);
+    store->dimensions = dimensions;
+    store->row_bytes = row_bytes;
+    store->file = memory_mapped_file_t(path);
+    serialization_result_t result = store->file.open_if_not();
+    if (!result) {
+        *error = result.error.release();
+        return nullptr;
+    }
+    if (store->file.size() % row_bytes) {
+        *error = "File size is not a multiple of the vector size!";
+        return nullptr;
+    }
+    store->rows_begin = store->file.data();
+    store->rows = store->file.size() / row_bytes;
+    return store.release();
+}
+
+USEARCH_EXPORT usearch_store_t usearch_store_init_callback( //
+    usearch_fetch_t fetch, void *state, usearch_scalar_kind_t kind, size_t dimensions, usearch_error_t *error) {
+    USEARCH_ASSERT(fetch && error && "Missing arguments");
+    std::size_t const row_bytes = (dimensions * bits_per_scalar(scalar_kind_to_cpp(kind)) + 7) / 8;
+    if (!row_bytes) {
+        *error = "Unknown scalar kind!";
+        return nullptr;
+    }
+
+    std::unique_ptr<vector_store_t> store(new vector_store_t());
+    store->kind = scalar_kind_to_cpp(kind);
+    store->dimensions = dimensions;
+    store->row_bytes = row_bytes;
+    store->fetch = fetch;
+    store->state = state;
+    return store.release();
+}
+
+USEARCH_EXPORT void usearch_store_free(usearch_store_t store, usearch_error_t *) {
+    delete reinterpret_cast<vector_store_t *>(store);
+}
+
+USEARCH_EXPORT size_t usearch_search_rerank( //
+    usearch_index_t index, //
+    void const *query, usearch_scalar_kind_t query_kind, size_t results_limit, //
+    size_t oversample, usearch_store_t store, //
+    usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
+    USEARCH_ASSERT(index && query && store && error && "Missing arguments");
+    vector_store_t const &vectors = *reinterpret_cast<vector_store_t const *>(store);
+    scalar_kind_t const kind = scalar_kind_to_cpp(query_kind);
+    if (kind != vectors.kind) {
+        *error = "Query and store scalar kinds differ!";
+        return 0;
+    }
+
+    shared_access_t access(index);
+    index_dense_t &index_dense = *dense_(index);
+    if (vectors.dimensions != index_dense.dimensions()) {
+        *error = "Store and index dimensions differ!";
+        return 0;
+    }
+    metric_punned_t metric(vectors.dimensions, index_dense.metric().metric_kind(), kind);
+    if (metric.missing()) {
+        *error = "Unknown metric kind!";
+        return 0;
+    }
+
+    // The quantized graph only has to get the true neighbors into the candidates, their order is recomputed below.
+    std::size_t const candidates_limit = results_limit * (oversample ? oversample : 1);
+    search_result_t result = search_(handle_(index), query, kind, candidates_limit);
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+    std::vector<usearch_key_t> candidates(candidates_limit);
+    std::size_t const candidates_count = result.dump_to(candidates.data());
+
+    std::vector<byte_t> scratch(vectors.row_bytes);
+    std::vector<std::pair<usearch_distance_t, usearch_key_t> > reranked;
+    reranked.reserve(candidates_count);
+    for (std::size_t i = 0; i != candidates_count; ++i) {
+        byte_t const *vector = vectors.find(candidates[i], scratch.data());
+        if (vector)
+            reranked.emplace_back(metric((byte_t const *) query, vector), candidates[i]);
+    }
+
+    std::size_t const found = (std::min)(results_limit, reranked.size());
+    std::partial_sort(reranked.begin(), reranked.begin() + found, reranked.end());
+    for (std::size_t i = 0; i != found; ++i) {
+        found_keys[i] = reranked[i].second;
+        if (found_distances)
+            found_distances[i] = reranked[i].first;
+    }
+    return found;
+}
+
+USEARCH_EXPORT size_t usearch_search_filter( //
+    usearch_index_t index, //
+    void const *query, usearch_scalar_kind_t query_kind, size_t results_limit, usearch_filter_t filter, //
+    usearch_key_t *found_keys, usearch_distance_t *found_distances, usearch_error_t *error) {
+    USEARCH_ASSERT(index && query && filter && error && "Missing arguments");
+    shared_access_t access(index);
+    key_filter_t const &f = *reinterpret_cast<key_filter_t const *>(filter);
+    scalar_kind_t const kind = scalar_kind_to_cpp(query_kind);
+
+    // Dispatch on the filter kind once, so the predicate visited per node is a plain inlined lookup.
+    switch (f.kind) {
+        case usearch_filter_bitset_k:
+            return search_filtered_(index, query, kind, results_limit, *f.bitset, f.exclude,
+                                    found_keys, found_distances, error);
+        case usearch_filter_sorted_k:
+            return search_filtered_(index, query, kind, results_limit, sorted_keys_t{f.sorted}, f.exclude,
+                                    found_keys, found_distances, error);
+        case usearch_filter_hash_k:
+            return search_filtered_(index, query, kind, results_limit, hashed_keys_t{f.hashed}, f.exclude,
+                                    found_keys, found_distances, error);
+        default:
+            *error = "Unknown filter kind!";
+            return 0;
+    }
+}
+
 USEARCH_EXPORT size_t usearch_get( //
     usearch_index_t index, usearch_key_t key, size_t count, //
-    void *vectors, usearch_scalar_kind_t kind, usearch_error_t *) {
-    USEARCH_ASSERT(index && vectors);
-    return get_(reinterpret_cast<index_dense_t *>(index), key, count, vectors, scalar_kind_to_cpp(kind));
+    void *vectors, usearch_scalar_kind_t kind, usearch_error_t *error) {
+    USEARCH_ASSERT(index && vectors && error && "Missing arguments");
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    if (!has_key_lookups_(handle, error))
+        return 0;
+    return get_(&handle.index, key, count, vectors, scalar_kind_to_cpp(kind));
+}
+
+USEARCH_EXPORT size_t usearch_get_batch( //
+    usearch_index_t index, usearch_key_t const *keys, size_t count, //
+    void *vectors, size_t stride, usearch_scalar_kind_t kind, size_t threads, usearch_error_t *error) {
+    USEARCH_ASSERT(index && keys && vectors && error && "Missing arguments");
+    auto &handle = handle_(index);
+    shared_access_t access(handle);
+    if (!has_key_lookups_(handle, error))
+        return 0;
+    index_dense_t *index_dense = &handle.index;
+    scalar_kind_t const scalar_kind = scalar_kind_to_cpp(kind);
+    std::size_t const row_bytes = (index_dense->dimensions() * bits_per_scalar(scalar_kind) + 7) / 8;
+    if (!row_bytes) {
+        *error = "Unknown scalar kind!";
+        return 0;
+    }
+
+    std::atomic<std::size_t> found(0);
+    auto export_row = [&](std::size_t, std::size_t task) {
+        byte_t *row = (byte_t *) vectors + task * stride;
+        if (get_(index_dense, keys[task], 1, row, scalar_kind))
+            found.fetch_add(1, std::memory_order_relaxed);
+        else
+            std::memset(row, 0, row_bytes);
+    };
+    // Copying a row is far cheaper than waking a thread, so small batches stay on the caller's thread.
+    if (threads == 1 || count < get_batch_parallel_threshold_k) {
+        for (std::size_t task = 0; task != count; ++task)
+            export_row(0, task);
+    } else {
+        executor_default_t executor(executor_threads_(threads, cores_()));
+        executor.fixed(count, export_row);
+    }
+    return found.load();
 }
 
 USEARCH_EXPORT size_t usearch_remove(usearch_index_t index, usearch_key_t key, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    labeling_result_t result = reinterpret_cast<index_dense_t *>(index)->remove(key);
+    auto &handle = handle_(index);
+    change_access_t change(handle);
+    shared_access_t access(handle);
+    if (!has_key_lookups_(handle, error))
+        return 0;
+    labeling_result_t result = handle.index.remove(key);
+    if (result.completed)
+        changed_(handle);
     if (!result)
         *error = result.error.release();
+    else if (result.completed && handle.wal && !handle.wal->log_remove(key))
+        *error = "Failed to write the log!";
     return result.completed;
 }
 
 USEARCH_EXPORT size_t usearch_rename( //
     usearch_index_t index, usearch_key_t from, usearch_key_t to, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    labeling_result_t result = reinterpret_cast<index_dense_t *>(index)->rename(from, to);
+    auto &handle = handle_(index);
+    change_access_t change(handle);
+    shared_access_t access(handle);
+    if (!has_key_lookups_(handle, error))
+        return 0;
+    labeling_result_t result = handle.index.rename(from, to);
+    if (result.completed)
+        changed_(handle);
     if (!result)
         *error = result.error.release();
+    else if (result.completed && handle.wal && !handle.wal->log_rename(from, to))
+        *error = "Failed to write the log!";
     return result.completed;
 }
 
@@ -445,6 +2442,72 @@ USEARCH_EXPORT usearch_distance_t usearch_distance( //
     return metric((byte_t const *) vector_first, (byte_t const *) vector_second);
 }
 
+USEARCH_EXPORT void usearch_distances( //
+    void const *query, void const *matrix, size_t count, size_t stride, //
+    usearch_scalar_kind_t scalar_kind, size_t dimensions, //
+    usearch_metric_kind_t metric_kind, size_t threads, //
+    usearch_distance_t *distances, usearch_error_t *error) {
+    USEARCH_ASSERT(query && (matrix || !count) && (distances || !count) && error && "Missing arguments");
+    metric_punned_t metric(dimensions, metric_kind_to_cpp(metric_kind), scalar_kind_to_cpp(scalar_kind));
+    if (metric.missing()) {
+        *error = "Unknown metric kind!";
+        return;
+    }
+
+    auto compute_row = [&](std::size_t, std::size_t row) {
+        distances[row] = metric((byte_t const *) query, (byte_t const *) matrix + row * stride);
+    };
+    if (threads == 1 || count * dimensions < distances_parallel_threshold_k) {
+        for (std::size_t row = 0; row != count; ++row)
+            compute_row(0, row);
+    } else {
+        executor_default_t executor(executor_threads_(threads, cores_()));
+        executor.fixed(count, compute_row);
+    }
+}
+
+USEARCH_EXPORT void usearch_distances_matrix( //
+    void const *queries, size_t queries_count, size_t queries_stride, //
+    void const *matrix, size_t count, size_t stride, //
+    usearch_scalar_kind_t scalar_kind, size_t dimensions, //
+    usearch_metric_kind_t metric_kind, size_t threads, //
+    usearch_distance_t *distances, size_t distances_stride, //
+    usearch_error_t *error) {
+    USEARCH_ASSERT((queries || !queries_count) && (matrix || !count) && (distances || !queries_count) && error &&
+        "Missing arguments");
+    scalar_kind_t const kind = scalar_kind_to_cpp(scalar_kind);
+    metric_punned_t metric(dimensions, metric_kind_to_cpp(metric_kind), kind);
+    if (metric.missing()) {
+        *error = "Unknown metric kind!";
+        return;
+    }
+    if (!queries_count || !count)
+        return;
+
+    // Every task takes one tile of matrix rows and passes all queries over it,
+    // so that the rows are loaded from memory once instead of once per query.
+    std::size_t const row_bytes = (std::max)(std::size_t(1), (dimensions * bits_per_scalar(kind) + 7) / 8);
+    std::size_t const tile_rows = (std::max)(std::size_t(1), distances_tile_bytes_k / row_bytes);
+    std::size_t const tiles = (count + tile_rows - 1) / tile_rows;
+    auto compute_tile = [&](std::size_t, std::size_t tile) {
+        std::size_t const begin = tile * tile_rows;
+        std::size_t const end = (std::min)(begin + tile_rows, count);
+        for (std::size_t query = 0; query != queries_count; ++query) {
+            byte_t const *query_vector = (byte_t const *) queries + query * queries_stride;
+            auto row_distances = (usearch_distance_t *) ((byte_t *) distances + query * distances_stride);
+            for (std::size_t row = begin; row != end; ++row)
+                row_distances[row] = metric(query_vector, (byte_t const *) matrix + row * stride);
+        }
+    };
+    if (threads == 1 || queries_count * count * dimensions < distances_parallel_threshold_k) {
+        for (std::size_t tile = 0; tile != tiles; ++tile)
+            compute_tile(0, tile);
+    } else {
+        executor_default_t executor(executor_threads_(threads, cores_()));
+        executor.fixed(tiles, compute_tile);
+    }
+}
+
 USEARCH_EXPORT void usearch_exact_search( //
     void const *dataset, size_t dataset_count, size_t dataset_stride, //
     void const *queries, size_t queries_count, size_t queries_stride, //
@@ -456,31 +2519,488 @@ USEARCH_EXPORT void usearch_exact_search( //
     USEARCH_ASSERT(dataset && queries && keys && distances && error && "Missing arguments");
 
     metric_punned_t metric(dimensions, metric_kind_to_cpp(metric_kind), scalar_kind_to_cpp(scalar_kind));
-    executor_default_t executor(threads);
-    static exact_search_t search;
+    if (metric.missing()) {
+        *error = "Unknown metric kind!";
+        return;
+    }
+
+    // The scratch space lives as long as the call does, so that concurrent callers don't share it.
+    executor_default_t executor(executor_threads_(threads, cores_()));
+    exact_search_t search;
+    std::size_t const found = count < dataset_count ? count : dataset_count;
     exact_search_results_t result = search( //
         (byte_t const *) dataset, dataset_count, dataset_stride, //
         (byte_t const *) queries, queries_count, queries_stride, //
-        count, metric);
+        found, metric, executor);
 
     if (!result) {
         *error = "Out of memory, allocating a temporary buffer for batch results";
         return;
     }
 
-    // Export results into the output buffer
-    for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+    // Export results into the output buffer, every thread taking a contiguous tile of rows
+    executor.fixed(queries_count, [&](std::size_t, std::size_t query_idx) {
         auto query_result = result.at(query_idx);
         auto query_keys = (usearch_key_t *) ((byte_t *) keys + query_idx * keys_stride);
         auto query_distances = (usearch_distance_t *) ((byte_t *) distances + query_idx * distances_stride);
-        for (std::size_t i = 0; i != count; ++i)
+        for (std::size_t i = 0; i != found; ++i)
             query_keys[i] = static_cast<usearch_key_t>(query_result[i].offset),
                     query_distances[i] = static_cast<usearch_distance_t>(query_result[i].distance);
-    }
+    });
 }
 
 USEARCH_EXPORT void usearch_clear(usearch_index_t index, usearch_error_t *error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
-    reinterpret_cast<index_dense_t *>(index)->clear();
+    auto &handle = handle_(index);
+    exclusive_access_t access(handle);
+    handle.index.clear();
+    changed_(handle);
+    if (handle.wal && !handle.wal->log_clear())
+        *error = "Failed to write the log!";
+}
+
+USEARCH_EXPORT void usearch_compact(usearch_index_t index, size_t threads, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    exclusive_access_t access(index);
+    auto &index_dense = *dense_(index);
+    // Isolation and compaction pick their contexts by thread, so there is one per thread in the limits.
+    executor_default_t executor(executor_threads_(threads, index_dense.limits().threads()));
+    index_dense.isolate(executor);
+    auto result = index_dense.compact(executor);
+    changed_(handle_(index));
+    if (!result)
+        *error = result.error.release();
+}
+
+/**
+ *  @brief  Applies the records of the log at @p path to the index, stopping at the first torn or corrupted one.
+ *          Insertions replace the vectors already under their keys, unless the index is multi, so that records
+ *          already contained in the snapshot don't fail the replay.
+ *  @param[out] valid_length Number of leading bytes of the file holding whole records, `0` if there is no log.
+ */
+usearch_error_t replay_(usearch_index_t index, char const *path, std::size_t &replayed, std::size_t &valid_length) {
+    using wal_t = write_ahead_log_t;
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> file(std::fopen(path, "rb"), &std::fclose);
+    if (!file)
+        return nullptr;
+    char magic[sizeof(wal_t::wal_magic_k)];
+    if (std::fread(magic, 1, sizeof(magic), file.get()) != sizeof(magic))
+        return nullptr;
+    if (std::memcmp(magic, wal_t::wal_magic_k, sizeof(magic)) != 0)
+        return "Not a log file!";
+    valid_length = sizeof(magic);
+
+    index_dense_t const &index_dense = *dense_(index);
+    std::vector<byte_t> record;
+    // Vectors sit unaligned inside records, so they are copied out before insertion.
+    std::vector<std::uint64_t> vector;
+    auto read = [&](std::size_t length) {
+        std::size_t const offset = record.size();
+        record.resize(offset + length);
+        return std::fread(record.data() + offset, 1, length, file.get()) == length;
+    };
+    auto field = [&](std::size_t offset, std::size_t length, void *destination) {
+        std::memcpy(destination, record.data() + offset, length);
+    };
+    std::size_t const key_offset = sizeof(std::uint8_t);
+    std::size_t const payload_offset = key_offset + sizeof(usearch_key_t);
+    while (true) {
+        record.clear();
+        if (!read(payload_offset))
+            break;
+        std::uint8_t const operation = record[0];
+        bool whole = true;
+        if (operation == wal_t::add_k) {
+            std::uint32_t length = 0;
+            whole = read(sizeof(std::uint8_t) + sizeof(length));
+            if (whole) {
+                field(payload_offset + sizeof(std::uint8_t), sizeof(length), &length);
+                whole = length <= (std::uint32_t(1) << 30) && read(length);
+            }
+        } else if (operation == wal_t::rename_k) {
+            whole = read(sizeof(usearch_key_t));
+        } else if (operation != wal_t::remove_k && operation != wal_t::clear_k) {
+            break;
+        }
+        std::uint32_t checksum = 0;
+        std::size_t const checked = record.size();
+        if (!whole || !read(sizeof(checksum)))
+            break;
+        field(checked, sizeof(checksum), &checksum);
+        if (checksum != wal_t::checksum(record.data(), checked))
+            break;
+
+        usearch_key_t key;
+        field(key_offset, sizeof(key), &key);
+        usearch_error_t error = nullptr;
+        switch (operation) {
+            case wal_t::add_k: {
+                auto const kind = static_cast<usearch_scalar_kind_t>(record[payload_offset]);
+                std::size_t const vector_offset = payload_offset + sizeof(std::uint8_t) + sizeof(std::uint32_t);
+                std::size_t const expected =
+                        (index_dense.dimensions() * bits_per_scalar(scalar_kind_to_cpp(kind)) + 7) / 8;
+                if (!expected || checked - vector_offset != expected)
+                    return "Log doesn't match the dimensions of the index!";
+                // Without key lookups nothing can be replaced, and the log can only hold fresh keys.
+                if (!index_dense.multi() && handle_(index).key_lookups == usearch_key_lookups_hash_k)
+                    usearch_remove(index, key, &error);
+                vector.resize((expected + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+                field(vector_offset, expected, vector.data());
+                if (!error)
+                    usearch_add(index, key, vector.data(), kind, &error);
+                break;
+            }
+            case wal_t::remove_k: usearch_remove(index, key, &error); break;
+            case wal_t::rename_k: {
+                usearch_key_t to;
+                field(payload_offset, sizeof(to), &to);
+                usearch_rename(index, key, to, &error);
+                break;
+            }
+            default: usearch_clear(index, &error); break;
+        }
+        if (error)
+            return error;
+        valid_length += record.size();
+        ++replayed;
+    }
+    return nullptr;
+}
+
+/// Does the work of `checkpoint_` under shared access, which keeps structural changes out.
+usearch_error_t snapshot_(index_handle_t &handle, std::string const &path) {
+    shared_access_t access(handle);
+    std::string const temporary = path + ".tmp";
+    serialization_result_t result = handle.index.save(temporary.c_str());
+    if (!result)
+        return result.error.release();
+    {
+        std::unique_ptr<std::FILE, int (*)(std::FILE *)> file(std::fopen(temporary.c_str(), "rb+"), &std::fclose);
+        if (!file || !sync_file_(file.get()))
+            return "Failed to sync the snapshot!";
+    }
+#if defined(_WIN32)
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0)
+        return "Failed to replace the snapshot!";
+    return handle.wal ? handle.wal->truncate() : nullptr;
+}
+
+/**
+ *  @brief  Saves a snapshot next to @p path, syncs it, atomically moves it over @p path, then empties the log.
+ *          A crash at any point leaves either the old snapshot with the full log or the new one.
+ *
+ *  In the thread-safe mode only changes wait for it, while searches go on under shared access.
+ *  Otherwise the caller must keep changes apart from it.
+ */
+usearch_error_t checkpoint_(index_handle_t &handle, std::string const &path) {
+    if (handle.thread_safe)
+        handle.change_mutex.lock();
+    usearch_error_t failure = snapshot_(handle, path);
+    if (handle.thread_safe)
+        handle.change_mutex.unlock();
+    return failure;
+}
+
+USEARCH_EXPORT size_t usearch_wal_open(usearch_index_t index, char const *path, size_t sync_every,
+                                       usearch_error_t *error) {
+    USEARCH_ASSERT(index && path && error && "Missing arguments");
+    auto &handle = handle_(index);
+    if (handle.wal) {
+        *error = "A log is already open!";
+        return 0;
+    }
+    std::size_t replayed = 0;
+    std::size_t valid_length = 0;
+    *error = replay_(index, path, replayed, valid_length);
+    if (*error)
+        return replayed;
+
+    std::unique_ptr<write_ahead_log_t> wal(new write_ahead_log_t());
+    *error = wal->open(path, valid_length, replayed, sync_every);
+    if (*error)
+        return replayed;
+    exclusive_access_t access(handle);
+    handle.wal = std::move(wal);
+    return replayed;
+}
+
+USEARCH_EXPORT void usearch_wal_sync(usearch_index_t index, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    auto &handle = handle_(index);
+    *error = handle.checkpoint_failure.exchange(nullptr);
+    shared_access_t access(handle);
+    if (!*error && handle.wal && !handle.wal->sync())
+        *error = "Failed to sync the log!";
+}
+
+USEARCH_EXPORT void usearch_wal_close(usearch_index_t index, usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    auto &handle = handle_(index);
+    exclusive_access_t access(handle);
+    if (handle.wal && !handle.wal->sync())
+        *error = "Failed to sync the log!";
+    handle.wal.reset();
+}
+
+USEARCH_EXPORT void usearch_checkpoint(usearch_index_t index, char const *path, usearch_error_t *error) {
+    USEARCH_ASSERT(index && path && error && "Missing arguments");
+    *error = checkpoint_(handle_(index), path);
+}
+
+USEARCH_EXPORT void usearch_checkpoint_every(usearch_index_t index, char const *path, size_t interval_ms,
+                                             size_t min_records, usearch_error_t *error) {
+    USEARCH_ASSERT(index && (path || !interval_ms) && error && "Missing arguments");
+    auto &handle = handle_(index);
+    if (interval_ms && !handle.thread_safe) {
+        *error = "Background checkpoints need a thread-safe index!";
+        return;
+    }
+    // The previous checkpointer finishes its current checkpoint before it's replaced.
+    std::lock_guard<std::mutex> lock(handle.checkpointer_mutex);
+    handle.checkpointer.reset();
+    if (!interval_ms)
+        return;
+
+    index_handle_t *owner = &handle;
+    std::string const snapshot(path);
+    handle.checkpointer.reset(new periodic_task_t(std::chrono::milliseconds(interval_ms), [=] {
+        {
+            shared_access_t access(*owner);
+            if (owner->wal && owner->wal->records() < min_records)
+                return;
+        }
+        usearch_error_t failure = checkpoint_(*owner, snapshot);
+        usearch_error_t expected = nullptr;
+        if (failure)
+            owner->checkpoint_failure.compare_exchange_strong(expected, failure);
+    }));
+}
+
+/// Detaches the queue, then answers its pending requests outside `queue_mutex`, as completions may submit again.
+/// Called from a completion, the queue is retired instead, and answers them on its own.
+void stop_queue_(index_handle_t &handle) {
+    std::unique_ptr<request_queue_t> retired;
+    std::unique_ptr<request_queue_t> queue;
+    std::lock_guard<std::mutex> lock(handle.queue_mutex);
+    queue.swap(handle.queue);
+    if (handle.retired_queue && !handle.retired_queue->dispatching())
+        retired.swap(handle.retired_queue);
+    if (queue && queue->dispatching()) {
+        queue->stop();
+        handle.retired_queue = std::move(queue);
+    }
+}
+
+/// Queues @p request under `queue_mutex`, so that the queue can't be stopped halfway through.
+bool submit_(index_handle_t &handle, request_queue_t::request_t &&request, void const *vector, usearch_error_t *error) {
+    std::lock_guard<std::mutex> lock(handle.queue_mutex);
+    if (!handle.queue) {
+        *error = "No request queue, see `usearch_queue_init`!";
+        return false;
+    }
+    return handle.queue->submit(std::move(request), vector);
+}
+
+USEARCH_EXPORT void usearch_queue_init(usearch_index_t index, size_t depth, size_t batch, size_t threads,
+                                       usearch_error_t *error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    if (!depth || !batch) {
+        *error = "Queue depth and batch size must be positive!";
+        return;
+    }
+    auto &handle = handle_(index);
+    // Both kinds of requests pick their contexts from the pools of the index, and more threads would only wait.
+    index_limits_t const limits = handle.index.limits();
+    std::size_t const contexts = (std::min)(limits.threads_search, limits.threads_add);
+    stop_queue_(handle);
+    std::unique_ptr<request_queue_t> queue(
+            new request_queue_t(handle, depth, batch, executor_threads_(threads, contexts)));
+    // Whatever a racing call installed meanwhile is swapped out, and stops once the lock is released.
+    std::lock_guard<std::mutex> lock(handle.queue_mutex);
+    queue.swap(handle.queue);
+}
+
+USEARCH_EXPORT void usearch_queue_free(usearch_index_t index, usearch_error_t *) {
+    USEARCH_ASSERT(index && "Missing arguments");
+    stop_queue_(handle_(index));
+}
+
+USEARCH_EXPORT bool usearch_submit_search(                                                        //
+    usearch_index_t index, void const *query, usearch_scalar_kind_t query_kind, size_t count, //
+    usearch_searched_t searched, void *state, usearch_error_t *error) {
+    USEARCH_ASSERT(index && query && searched && error && "Missing arguments");
+    request_queue_t::request_t request;
+    request.searched = searched;
+    request.state = state;
+    request.kind = query_kind;
+    request.keys.resize(count);
+    request.distances.resize(count);
+    return submit_(handle_(index), std::move(request), query, error);
+}
+
+USEARCH_EXPORT bool usearch_submit_add(                                                              //
+    usearch_index_t index, usearch_key_t key, void const *vector, usearch_scalar_kind_t vector_kind, //
+    usearch_added_t added, void *state, usearch_error_t *error) {
+    USEARCH_ASSERT(index && vector && added && error && "Missing arguments");
+    request_queue_t::request_t request;
+    request.added = added;
+    request.state = state;
+    request.key = key;
+    request.kind = vector_kind;
+    return submit_(handle_(index), std::move(request), vector, error);
+}
+
+USEARCH_EXPORT usearch_sharded_t usearch_sharded_init(usearch_init_options_t *options, size_t shards,
+                                                      usearch_error_t *error) {
+    USEARCH_ASSERT(options && error && "Missing arguments");
+    if (!shards) {
+        *error = "At least one shard is required!";
+        return NULL;
+    }
+    // Keys are spread across the shards, so none of them numbers its members densely.
+    if (options->key_lookups == usearch_key_lookups_identity_k) {
+        *error = "Identity keys can't be sharded!";
+        return NULL;
+    }
+
+    std::unique_ptr<sharded_handle_t> sharded(new sharded_handle_t());
+    for (std::size_t i = 0; i != shards; ++i) {
+        std::unique_ptr<index_handle_t> shard(static_cast<index_handle_t *>(usearch_init(options, error)));
+        if (*error)
+            return NULL;
+        sharded->shards.push_back(std::move(shard));
+    }
+    // The calling thread searches one of the shards itself.
+    std::size_t const cores = std::thread::hardware_concurrency();
+    std::size_t const threads = cores && cores < shards ? cores : shards;
+    sharded->pool.reset(new task_pool_t(threads - 1));
+    return sharded.release();
+}
+
+USEARCH_EXPORT void usearch_sharded_free(usearch_sharded_t sharded, usearch_error_t *) {
+    delete reinterpret_cast<sharded_handle_t *>(sharded);
+}
+
+USEARCH_EXPORT size_t usearch_sharded_count(usearch_sharded_t sharded, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && error && "Missing arguments");
+    return sharded_(sharded).shards.size();
+}
+
+USEARCH_EXPORT usearch_index_t usearch_sharded_shard(usearch_sharded_t sharded, size_t shard,
+                                                     usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && error && "Missing arguments");
+    auto &shards = sharded_(sharded).shards;
+    if (shard >= shards.size()) {
+        *error = "Shard out of range!";
+        return NULL;
+    }
+    return shards[shard].get();
+}
+
+USEARCH_EXPORT size_t usearch_sharded_size(usearch_sharded_t sharded, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && error && "Missing arguments");
+    std::size_t size = 0;
+    for (auto &shard: sharded_(sharded).shards)
+        size += usearch_size(shard.get(), error);
+    return size;
+}
+
+USEARCH_EXPORT void usearch_sharded_add(usearch_sharded_t sharded, usearch_key_t key, void const *vector,
+                                        usearch_scalar_kind_t kind, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && vector && error && "Missing arguments");
+    auto &handle = sharded_(sharded);
+    usearch_add(handle.shards[handle.route(key)].get(), key, vector, kind, error);
+}
+
+USEARCH_EXPORT void usearch_sharded_add_batch( //
+    usearch_sharded_t sharded, usearch_key_t const *keys, void const *vectors, size_t count, //
+    size_t stride, usearch_scalar_kind_t kind, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && keys && vectors && error && "Missing arguments");
+    auto &handle = sharded_(sharded);
+    std::vector<std::vector<std::size_t> > rows(handle.shards.size());
+    for (std::size_t row = 0; row != count; ++row)
+        rows[handle.route(keys[row])].push_back(row);
+
+    // Every shard is filled by one thread, so shards insert in parallel with no contention between them,
+    // and each logs its own rows.
+    std::atomic<usearch_error_t> failure(nullptr);
+    handle.pool->for_each(handle.shards.size(), [&](std::size_t shard) {
+        if (rows[shard].empty())
+            return;
+        index_handle_t &shard_handle = *handle.shards[shard];
+        usearch_error_t shard_failure =
+                grow_and_add_rows_(shard_handle, keys, vectors, count, stride, kind, std::move(rows[shard]), 1);
+        usearch_error_t expected = nullptr;
+        if (shard_failure)
+            failure.compare_exchange_strong(expected, shard_failure);
+    });
+    if (failure.load())
+        *error = failure.load();
+}
+
+USEARCH_EXPORT size_t usearch_sharded_remove(usearch_sharded_t sharded, usearch_key_t key, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && error && "Missing arguments");
+    auto &handle = sharded_(sharded);
+    return usearch_remove(handle.shards[handle.route(key)].get(), key, error);
+}
+
+USEARCH_EXPORT bool usearch_sharded_contains(usearch_sharded_t sharded, usearch_key_t key, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && error && "Missing arguments");
+    auto &handle = sharded_(sharded);
+    return usearch_contains(handle.shards[handle.route(key)].get(), key, error);
+}
+
+USEARCH_EXPORT size_t usearch_sharded_search( //
+    usearch_sharded_t sharded, void const *query, usearch_scalar_kind_t kind, size_t count, //
+    usearch_key_t *keys, usearch_distance_t *distances, usearch_error_t *error) {
+    USEARCH_ASSERT(sharded && query && error && "Missing arguments");
+    auto &handle = sharded_(sharded);
+    std::size_t const shards = handle.shards.size();
+    std::vector<usearch_key_t> shard_keys(shards * count);
+    std::vector<usearch_distance_t> shard_distances(shards * count);
+    std::vector<std::size_t> found(shards, 0);
+    std::atomic<usearch_error_t> failure(nullptr);
+    handle.pool->for_each(shards, [&](std::size_t shard) {
+        usearch_error_t shard_error = nullptr;
+        found[shard] = usearch_search(handle.shards[shard].get(), query, kind, count, shard_keys.data() + shard * count,
+                                      shard_distances.data() + shard * count, &shard_error);
+        if (shard_error) {
+            usearch_error_t expected = nullptr;
+            failure.compare_exchange_strong(expected, shard_error);
+        }
+    });
+    if (failure.load()) {
+        *error = failure.load();
+        return 0;
+    }
+
+    // Every shard returns its neighbors closest first, so a heap of the shards' next candidates
+    // yields the global top-k in `O(k log shards)`.
+    struct candidate_t {
+        usearch_distance_t distance;
+        std::size_t shard;
+        std::size_t rank;
+
+        bool operator>(candidate_t const &other) const noexcept { return distance > other.distance; }
+    };
+    std::priority_queue<candidate_t, std::vector<candidate_t>, std::greater<candidate_t> > candidates;
+    for (std::size_t shard = 0; shard != shards; ++shard)
+        if (found[shard])
+            candidates.push({shard_distances[shard * count], shard, 0});
+
+    std::size_t merged = 0;
+    for (; merged != count && !candidates.empty(); ++merged) {
+        candidate_t candidate = candidates.top();
+        candidates.pop();
+        keys[merged] = shard_keys[candidate.shard * count + candidate.rank];
+        distances[merged] = candidate.distance;
+        if (++candidate.rank != found[candidate.shard]) {
+            candidate.distance = shard_distances[candidate.shard * count + candidate.rank];
+            candidates.push(candidate);
+        }
+    }
+    return merged;
 }
 }
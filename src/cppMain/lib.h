@@ -60,6 +60,152 @@ USEARCH_EXPORT typedef enum usearch_scalar_kind_t {
     usearch_scalar_b1_k = 5,
 } usearch_scalar_kind_t;
 
+/**
+ *  @brief  Handle to a native key predicate, see `usearch_filter_init`.
+ */
+USEARCH_EXPORT typedef void* usearch_filter_t;
+
+/**
+ *  @brief  Number of buckets in the latency histograms of `usearch_stats_t`.
+ *  Bucket `i` below 8 holds latencies of exactly `i` nanoseconds. Above that, every power of two is split into
+ *  8 buckets: bucket `i` starts at `(8 + i % 8) << (i / 8 - 1)` nanoseconds. The last bucket also holds
+ *  everything slower, from about 16 seconds on.
+ */
+#define USEARCH_LATENCY_BUCKETS 256
+
+/**
+ *  @brief  Work done by an index since statistics were enabled or last reset, see `usearch_stats`.
+ */
+USEARCH_EXPORT typedef struct usearch_stats_t {
+    /** Number of searches, counting every query of a batch. */
+    size_t searches;
+    /** Number of graph nodes whose neighbors were expanded, by searches and insertions together. */
+    size_t hops;
+    /** Number of distances computed, by searches and insertions together. */
+    size_t distances;
+    /** Number of candidates rejected by search filters. */
+    size_t filtered;
+    /** Number of vectors added. */
+    size_t adds;
+    /** Histogram of search latencies, see `USEARCH_LATENCY_BUCKETS`. */
+    size_t search_latency[USEARCH_LATENCY_BUCKETS];
+    /** Histogram of insertion latencies, see `USEARCH_LATENCY_BUCKETS`. */
+    size_t add_latency[USEARCH_LATENCY_BUCKETS];
+} usearch_stats_t;
+
+/**
+ *  @brief  Effectiveness of the search result cache, see `usearch_enable_cache`.
+ */
+USEARCH_EXPORT typedef struct usearch_cache_stats_t {
+    /** Number of searches answered from the cache. */
+    size_t hits;
+    /** Number of searches that went to the graph, including those that found a stale entry. */
+    size_t misses;
+    /** Number of results held, stale ones included until they are looked up or evicted. */
+    size_t entries;
+} usearch_cache_stats_t;
+
+/**
+ *  @brief  Where the memory of an index goes, see `usearch_memory_breakdown`.
+ */
+USEARCH_EXPORT typedef struct usearch_memory_breakdown_t {
+    /** Bytes of graph nodes, their headers and neighbor lists on every level. */
+    size_t graph;
+    /** Bytes of vectors, after quantization. */
+    size_t vectors;
+    /** Bytes of the key to slot lookup table, estimated from the capacity. */
+    size_t lookup;
+    /** Bytes of the arena of `usearch_load_huge_pages`, which holds the graph and the vectors of such indexes. */
+    size_t huge_pages;
+    /** Bytes of everything else: per-thread search contexts, per-slot bookkeeping and allocator slack. */
+    size_t other;
+    /** Bytes used by the index in total, same as `usearch_memory_usage`. The graph and the vectors of views
+     *  count towards it only when they are in the huge page arena rather than in a mapped file. */
+    size_t total;
+} usearch_memory_breakdown_t;
+
+/**
+ *  @brief  Handle to a set of dense indexes with keys spread across them, see `usearch_sharded_init`.
+ */
+USEARCH_EXPORT typedef void* usearch_sharded_t;
+
+/**
+ *  @brief  Data structures a `usearch_filter_t` can keep its keys in.
+ */
+USEARCH_EXPORT typedef enum usearch_filter_kind_t {
+    /** Roaring-style bitset, compact and fast for dense or clustered key ranges. */
+    usearch_filter_bitset_k = 0,
+    /** Sorted key array, smallest for few scattered keys, looked up by binary search. */
+    usearch_filter_sorted_k = 1,
+    /** Hash set, constant-time lookups at the highest memory cost. */
+    usearch_filter_hash_k = 2,
+} usearch_filter_kind_t;
+
+/**
+ *  @brief  Handle to full-precision copies of the vectors of a quantized index, see `usearch_search_rerank`.
+ */
+USEARCH_EXPORT typedef void* usearch_store_t;
+
+/**
+ *  @brief  Source for `usearch_store_init_callback`, copying the full-precision vector of `key` into `vector`.
+ *  @return `true` if the vector was copied, `false` if the store doesn't have it.
+ */
+USEARCH_EXPORT typedef bool (*usearch_fetch_t)(usearch_key_t key, void* vector, void* state);
+
+/**
+ *  @brief  Completion of `usearch_submit_search`, called once on the dispatcher thread of the request queue.
+ *          `keys` and `distances` hold `found` neighbors, closest first, and are only valid during the call.
+ *          `error` is `NULL` unless the search failed.
+ */
+USEARCH_EXPORT typedef void (*usearch_searched_t)(usearch_key_t const* keys, usearch_distance_t const* distances,
+                                                  size_t found, usearch_error_t error, void* state);
+
+/**
+ *  @brief  Completion of `usearch_submit_add`, called once on the dispatcher thread of the request queue.
+ *          `error` is `NULL` unless the insertion failed.
+ */
+USEARCH_EXPORT typedef void (*usearch_added_t)(usearch_error_t error, void* state);
+
+/**
+ *  @brief  Sink for `usearch_save_stream`, receiving the serialized index piece by piece.
+ *  @return `true` if all `length` bytes were consumed, `false` to abort serialization.
+ */
+USEARCH_EXPORT typedef bool (*usearch_write_t)(void const* data, size_t length, void* state);
+
+/**
+ *  @brief  Source for `usearch_load_stream`, which must fill @b exactly `length` bytes of `data`.
+ *  @return `true` on success, `false` to abort deserialization, e.g. on a premature end of stream.
+ */
+USEARCH_EXPORT typedef bool (*usearch_read_t)(void* data, size_t length, void* state);
+
+/**
+ *  @brief  Access pattern hints for a memory-mapped view, see `usearch_view_file`.
+ */
+USEARCH_EXPORT typedef enum usearch_view_advice_t {
+    /** Leave the kernel defaults, with moderate read-ahead. */
+    usearch_view_normal_k = 0,
+    /** Expect random access, disabling read-ahead, which suits graph traversal on a cold page cache. */
+    usearch_view_random_k = 1,
+    /** Expect sequential access, with aggressive read-ahead. */
+    usearch_view_sequential_k = 2,
+    /** Start reading the whole file in the background, so later faults are mostly served from the page cache. */
+    usearch_view_willneed_k = 3,
+} usearch_view_advice_t;
+
+/**
+ *  @brief  How an index finds the slot of a key, see `usearch_init_options_t::key_lookups`.
+ */
+USEARCH_EXPORT typedef enum usearch_key_lookups_t {
+    /** A hash table from keys to slots, allowing any keys, as well as getting, removing and renaming by key. */
+    usearch_key_lookups_hash_k = 0,
+    /** No table, saving its memory and the cost of updating it on every insertion.
+     *  Keys only come back from searches, so getting, counting, removing and renaming by key fail. */
+    usearch_key_lookups_none_k = 1,
+    /** Same as `usearch_key_lookups_none_k`, with keys promised to be `0, 1, 2, ...` in the order of insertion,
+     *  so that the index can tell whether it contains a key. The promise isn't checked. */
+    usearch_key_lookups_identity_k = 2,
+} usearch_key_lookups_t;
+
 USEARCH_EXPORT typedef struct usearch_init_options_t {
     /**
      *  @brief The metric kind used for distance calculation between vectors.
@@ -106,6 +252,19 @@ USEARCH_EXPORT typedef struct usearch_init_options_t {
      *  @brief When set allows multiple vectors to map to the same key.
      */
     bool multi;
+    /**
+     *  @brief When set, structural changes like `usearch_reserve`, `usearch_load`, `usearch_view`, `usearch_clear`
+     *  or `usearch_change_metric` wait for in-flight operations and block new ones, so that they can be called
+     *  concurrently with `usearch_add` and `usearch_search`. Otherwise the caller must keep them apart, and
+     *  also keep apart insertions that outgrow the capacity, as growing reallocates the index in place.
+     *  Reserving ahead with `usearch_reserve` lets such indexes add and search concurrently.
+     */
+    bool thread_safe;
+    /**
+     *  @brief How keys are mapped to slots. Defaults to a hash table, which indexes with dense sequential keys
+     *  can do without, see `usearch_key_lookups_identity_k`.
+     */
+    usearch_key_lookups_t key_lookups;
 } usearch_init_options_t;
 
 /**
@@ -137,6 +296,15 @@ USEARCH_EXPORT void usearch_free(usearch_index_t index, usearch_error_t* error);
  */
 USEARCH_EXPORT size_t usearch_memory_usage(usearch_index_t index, usearch_error_t* error);
 
+/**
+ *  @brief  Splits `usearch_memory_usage` into its main consumers, walking every node of the graph.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[out] breakdown Receives the number of bytes used by every part.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_memory_breakdown(usearch_index_t index, usearch_memory_breakdown_t* breakdown,
+                                             usearch_error_t* error);
+
 /**
  *  @brief Reports the SIMD capabilities used by the index on the current CPU.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -168,6 +336,28 @@ USEARCH_EXPORT void usearch_save(usearch_index_t index, char const* path, usearc
  */
 USEARCH_EXPORT void usearch_load(usearch_index_t index, char const* path, usearch_error_t* error);
 
+/**
+ *  @brief  Saves the index through a callback, in constant memory. Small pieces are coalesced,
+ *          so `write` is called with chunks of up to 64 KiB, and larger pieces are passed through as they are.
+ *  @param[in] index The handle to the USearch index to be serialized.
+ *  @param[in] write The sink receiving the serialized bytes in order.
+ *  @param[in] state The @b optional state pointer to be passed to `write`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_save_stream(usearch_index_t index, usearch_write_t write, void* state,
+                                        usearch_error_t* error);
+
+/**
+ *  @brief  Loads the index through a callback, in constant memory besides the index itself.
+ *          Never requests bytes past the end of the serialized index, so other data may follow it in the stream.
+ *  @param[inout] index The handle to the USearch index to be populated.
+ *  @param[in] read The source of the serialized bytes, in order.
+ *  @param[in] state The @b optional state pointer to be passed to `read`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_load_stream(usearch_index_t index, usearch_read_t read, void* state,
+                                        usearch_error_t* error);
+
 /**
  *  @brief Creates a view of the index from a file without copying it into memory.
  *  @param[inout] index The handle to the USearch index to be populated with a file view.
@@ -176,6 +366,18 @@ USEARCH_EXPORT void usearch_load(usearch_index_t index, char const* path, usearc
  */
 USEARCH_EXPORT void usearch_view(usearch_index_t index, char const* path, usearch_error_t* error);
 
+/**
+ *  @brief  Same as `usearch_view`, but passes an access pattern hint for the mapping to the kernel.
+ *          Pages are faulted in lazily as searches touch them, so the view is ready to serve right away.
+ *          The hint is ignored on platforms without `madvise`.
+ *  @param[inout] index The handle to the USearch index to be populated with a file view.
+ *  @param[in] path The file path from where the view will be created.
+ *  @param[in] advice The expected access pattern.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_view_file(usearch_index_t index, char const* path, usearch_view_advice_t advice,
+                                      usearch_error_t* error);
+
 /**
  *  @brief Loads index metadata from a file.
  *  @param[in] path The file path from where the index will be loaded.
@@ -203,6 +405,17 @@ USEARCH_EXPORT void usearch_save_buffer(usearch_index_t index, void* buffer, siz
 USEARCH_EXPORT void usearch_load_buffer(usearch_index_t index, void const* buffer, size_t length,
                                         usearch_error_t* error);
 
+/**
+ *  @brief  Loads the index from a file into memory backed by huge pages, for large indexes whose searches are
+ *          bound by TLB misses. Explicit huge pages are used if reserved, e.g. in `/proc/sys/vm/nr_hugepages`,
+ *          and transparent huge pages otherwise. Like a view, the index can't be modified afterward.
+ *          Outside of Linux, it's a copy into regular memory.
+ *  @param[inout] index The handle to the USearch index to be populated.
+ *  @param[in] path The file path from where the index will be loaded.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_load_huge_pages(usearch_index_t index, char const* path, usearch_error_t* error);
+
 /**
  *  @brief Creates a view of the index from an in-memory buffer without copying it into memory.
  *  @param[inout] index The handle to the USearch index to be populated with a buffer view.
@@ -236,6 +449,58 @@ USEARCH_EXPORT size_t usearch_size(usearch_index_t index, usearch_error_t* error
  */
 USEARCH_EXPORT size_t usearch_capacity(usearch_index_t index, usearch_error_t* error);
 
+/**
+ *  @brief Reports how many removed vectors still occupy slots in the index and are traversed during search.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of tombstones left since the last compaction. Counting them walks the whole graph.
+ */
+USEARCH_EXPORT size_t usearch_tombstones(usearch_index_t index, usearch_error_t* error);
+
+/**
+ *  @brief Turns the collection of `usearch_stats_t` on or off. While off, operations only pay for checking the flag.
+ *  Counters are kept when collection is turned off, and continue from where they were when it's turned back on.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[in] enabled Whether searches and insertions should be counted and timed.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_enable_stats(usearch_index_t index, bool enabled, usearch_error_t* error);
+
+/**
+ *  @brief Reports the work done by the index. Counters are summed over all threads without stopping them,
+ *  so a snapshot taken during operations may be slightly inconsistent.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[out] stats The structure to be filled, zeroed if statistics were never enabled.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_stats(usearch_index_t index, usearch_stats_t* stats, usearch_error_t* error);
+
+/**
+ *  @brief Zeroes all statistics of the index.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_reset_stats(usearch_index_t index, usearch_error_t* error);
+
+/**
+ *  @brief Caches the results of `usearch_search`, so that repeated queries skip the graph. Results are keyed by
+ *  the query bytes, its scalar kind, the number of results and `expansion_search`, and are evicted least recently
+ *  used first. Every addition, removal, renaming, clearing, loading or compaction makes all cached results stale,
+ *  so the cache only pays off on read-mostly indexes with hot queries.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[in] capacity The number of results to keep, or zero to drop the cache, as it is by default.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_enable_cache(usearch_index_t index, size_t capacity, usearch_error_t* error);
+
+/**
+ *  @brief Reports the hits and misses of the cache since it was enabled.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[out] stats The structure to be filled, zeroed if the cache is disabled.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_cache_stats(usearch_index_t index, usearch_cache_stats_t* stats, usearch_error_t* error);
+
 /**
  *  @brief Reports the current dimensions of the vectors in the index.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -258,6 +523,18 @@ USEARCH_EXPORT size_t usearch_connectivity(usearch_index_t index, usearch_error_
  */
 USEARCH_EXPORT void usearch_reserve(usearch_index_t index, size_t capacity, usearch_error_t* error);
 
+/**
+ *  @brief Updates how the index grows its capacity once insertions run out of it.
+ *  The new capacity is the current one multiplied by `factor`, but at least `min_step` slots larger.
+ *  By default the capacity doubles, growing by no less than 64 slots.
+ *  @param[inout] index The handle to the USearch index to be configured.
+ *  @param[in] factor Multiplier applied to the current capacity, must be at least `1`.
+ *  @param[in] min_step Lower bound on the number of slots added in one step, must be positive.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_change_growth_policy(usearch_index_t index, float factor, size_t min_step,
+                                                 usearch_error_t* error);
+
 /**
  *  @brief Retrieves the expansion value used during index creation.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -327,7 +604,7 @@ USEARCH_EXPORT void usearch_change_metric(usearch_index_t index, usearch_metric_
                                           usearch_metric_kind_t kind, usearch_error_t* error);
 
 /**
- *  @brief Adds a vector with a key to the index.
+ *  @brief Adds a vector with a key to the index, growing its capacity if needed.
  *  @param[inout] index The handle to the USearch index to be populated.
  *  @param[in] key The key associated with the vector.
  *  @param[in] vector Pointer to the vector data.
@@ -338,6 +615,22 @@ USEARCH_EXPORT void usearch_add(              //
     usearch_index_t index, usearch_key_t key, //
     void const* vector, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
 
+/**
+ *  @brief Adds a batch of vectors with their keys to the index, inserting them in parallel.
+ *  @param[inout] index The handle to the USearch index to be populated.
+ *  @param[in] keys Array of `count` keys associated with the vectors.
+ *  @param[in] vectors Pointer to the first scalar of the vectors matrix.
+ *  @param[in] count Number of vectors in the `vectors` matrix.
+ *  @param[in] stride Number of bytes between starts of consecutive vectors in `vectors`.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, `0` to use every add context.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_add_batch(                              //
+    usearch_index_t index, usearch_key_t const* keys,               //
+    void const* vectors, size_t count, size_t stride,               //
+    usearch_scalar_kind_t vector_kind, size_t threads, usearch_error_t* error);
+
 /**
  *  @brief Checks if the index contains a vector with a specific key.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -372,6 +665,119 @@ USEARCH_EXPORT size_t usearch_search(                                         //
     void const* query_vector, usearch_scalar_kind_t query_kind, size_t count, //
     usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
 
+/**
+ *  @brief  Finds the neighbors within a distance of the query, closest first, e.g. to find duplicates.
+ *          Rounds of searches ask for twice as many neighbors each, until the farthest one is beyond `max_distance`,
+ *          so the traversal work grows with the number of matches rather than with `max_results`.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] max_distance Largest distance of a match, inclusive.
+ *  @param[in] max_results Upper bound on the number of matches.
+ *  @param[out] keys Output buffer for up to `max_results` keys, also used as scratch space, so all of it may be written.
+ *  @param[out] distances Output buffer for up to `max_results` distances, written the same way as `keys`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_range_search(                                     //
+    usearch_index_t index,                                                     //
+    void const* query_vector, usearch_scalar_kind_t query_kind,                //
+    usearch_distance_t max_distance, size_t max_results,                       //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief  How `usearch_search_grouped` scores a key from the distances of its vectors.
+ */
+USEARCH_EXPORT typedef enum usearch_aggregation_t {
+    /** Distance of the closest vector of the key. */
+    usearch_aggregation_min_k = 0,
+    /** Mean distance of the vectors of the key among the candidates. */
+    usearch_aggregation_mean_k = 1,
+    /**
+     * Sum of the `top_m` smallest distances of the key among the candidates, favoring keys with many close vectors.
+     * A key with fewer candidates counts the distance of the farthest candidate for each missing one.
+     */
+    usearch_aggregation_top_sum_k = 2,
+} usearch_aggregation_t;
+
+/**
+ *  @brief  Finds the closest distinct keys of a multi-vector index, so that a key with many vectors takes one slot
+ *          instead of crowding out the others. Rounds of searches ask for twice as many candidates each,
+ *          until `count` distinct keys are among them or the index is exhausted. Mean and sum only see the vectors
+ *          of a key that made it into the candidates, so they are approximate beyond the closest ones.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] count Upper bound on the number of distinct keys to return.
+ *  @param[in] aggregation How the distances of the vectors of a key are combined.
+ *  @param[in] top_m Number of distances summed by `usearch_aggregation_top_sum_k`, ignored otherwise.
+ *  @param[out] keys Output buffer for up to `count` distinct keys, best first.
+ *  @param[out] distances Output buffer for up to `count` aggregated distances.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found keys.
+ */
+USEARCH_EXPORT size_t usearch_search_grouped(                                  //
+    usearch_index_t index,                                                    //
+    void const* query_vector, usearch_scalar_kind_t query_kind, size_t count, //
+    usearch_aggregation_t aggregation, size_t top_m,                          //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief Same as `usearch_range_search`, for a batch of queries in parallel.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] queries Pointer to the first scalar of the queries matrix.
+ *  @param[in] query_kind The scalar type used in the queries matrix.
+ *  @param[in] queries_count Number of vectors in the `queries` matrix.
+ *  @param[in] queries_stride Number of bytes between starts of consecutive vectors in `queries`.
+ *  @param[in] max_distance Largest distance of a match, inclusive.
+ *  @param[in] max_results Upper bound on the number of matches for every query.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, `0` to use every search context.
+ *  @param[out] keys Output matrix for `queries_count * max_results` keys, rows separated by `keys_stride` bytes.
+ *  @param[in] keys_stride Number of bytes between starts of consecutive rows of `keys`.
+ *  @param[out] distances Output matrix for `queries_count * max_results` distances,
+ *              rows separated by `distances_stride` bytes.
+ *  @param[in] distances_stride Number of bytes between starts of consecutive rows of `distances`.
+ *  @param[out] counts Output buffer for `queries_count` numbers of matches found for every query.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Total number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_range_search_batch(                      //
+    usearch_index_t index,                                            //
+    void const* queries, usearch_scalar_kind_t query_kind,            //
+    size_t queries_count, size_t queries_stride,                      //
+    usearch_distance_t max_distance, size_t max_results, size_t threads, //
+    usearch_key_t* keys, size_t keys_stride,                          //
+    usearch_distance_t* distances, size_t distances_stride,           //
+    size_t* counts, usearch_error_t* error);
+
+/**
+ *  @brief Performs k-Approximate Nearest Neighbors (kANN) Search for a batch of queries in parallel.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] queries Pointer to the first scalar of the queries matrix.
+ *  @param[in] query_kind The scalar type used in the queries matrix.
+ *  @param[in] queries_count Number of vectors in the `queries` matrix.
+ *  @param[in] queries_stride Number of bytes between starts of consecutive vectors in `queries`.
+ *  @param[in] count Upper bound on the number of neighbors to search for every query, the "k" in "kANN".
+ *  @param[in] threads Upper bound for the number of CPU threads to use, `0` to use every search context.
+ *  @param[out] keys Output matrix for `queries_count * count` nearest neighbors keys. Each row of the
+ *              matrix must be contiguous in memory, but different rows can be separated by `keys_stride` bytes.
+ *  @param[in] keys_stride Number of bytes between starts of consecutive rows od scalars in `keys`.
+ *  @param[out] distances Output matrix for `queries_count * count` distances to nearest neighbors. Each row of the
+ *              matrix must be contiguous in memory, but different rows can be separated by `distances_stride` bytes.
+ *  @param[in] distances_stride Number of bytes between starts of consecutive rows od scalars in `distances`.
+ *  @param[out] counts Output buffer for `queries_count` numbers of matches found for every query.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Total number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_search_batch(                          //
+    usearch_index_t index,                                           //
+    void const* queries, usearch_scalar_kind_t query_kind,           //
+    size_t queries_count, size_t queries_stride,                     //
+    size_t count, size_t threads,                                    //
+    usearch_key_t* keys, size_t keys_stride,                         //
+    usearch_distance_t* distances, size_t distances_stride,          //
+    size_t* counts, usearch_error_t* error);
+
 /**
  *  @brief  Performs k-Approximate Nearest Neighbors (kANN) Search for closest vectors to query,
  *          predicated on a custom function that returns `true` for vectors to be included.
@@ -393,6 +799,103 @@ USEARCH_EXPORT size_t usearch_filtered_search(                                //
     int (*filter)(usearch_key_t key, void* filter_state), void* filter_state, //
     usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
 
+/**
+ *  @brief  Builds a native predicate over a set of keys, to be reused across `usearch_search_filter` calls.
+ *          The keys are copied, so the input buffer can be released right away.
+ *
+ *  @param[in] kind The data structure to keep the keys in.
+ *  @param[in] keys The allowed keys, or the denied ones if `exclude` is set.
+ *  @param[in] count Number of keys in `keys`.
+ *  @param[in] exclude When set, the filter admits every key @b except the given ones.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return A handle to the filter, to be released with `usearch_filter_free`.
+ */
+USEARCH_EXPORT usearch_filter_t usearch_filter_init(                       //
+    usearch_filter_kind_t kind, usearch_key_t const* keys, size_t count, //
+    bool exclude, usearch_error_t* error);
+
+/**
+ *  @brief Frees the resources associated with a filter.
+ *  @param[in] filter The handle to the filter to be freed.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_filter_free(usearch_filter_t filter, usearch_error_t* error);
+
+/**
+ *  @brief  Same as `usearch_filtered_search`, but with a predicate built by `usearch_filter_init`,
+ *          which is evaluated entirely in native code. The filter may be shared by concurrent searches.
+ *
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
+ *  @param[in] filter The predicate that keys must satisfy to be included.
+ *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for up to `count` distances to nearest neighbors.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_search_filter(                                   //
+    usearch_index_t index,                                                    //
+    void const* query_vector, usearch_scalar_kind_t query_kind, size_t count, //
+    usearch_filter_t filter,                                                  //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief  Maps a file of full-precision vectors into memory, to re-rank the candidates of a quantized index with.
+ *          The file is a raw row-major matrix in native byte order without any header, row `i` holding the vector
+ *          of key `i`. Keys past the last row are treated as missing.
+ *  @param[in] path The file path of the matrix.
+ *  @param[in] kind The scalar type of the matrix, usually `usearch_scalar_f32_k` or `usearch_scalar_f64_k`.
+ *  @param[in] dimensions The number of dimensions in each vector, matching the index.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return A handle to the store, to be released with `usearch_store_free`.
+ */
+USEARCH_EXPORT usearch_store_t usearch_store_map_file(                          //
+    char const* path, usearch_scalar_kind_t kind, size_t dimensions, usearch_error_t* error);
+
+/**
+ *  @brief  Wraps a callback reading full-precision vectors by key, to re-rank the candidates of a quantized index with.
+ *          Concurrent searches with the same store call `fetch` concurrently.
+ *  @param[in] fetch The source of the vectors, called once per candidate.
+ *  @param[in] state The @b optional state pointer to be passed to `fetch`.
+ *  @param[in] kind The scalar type `fetch` writes.
+ *  @param[in] dimensions The number of dimensions in each vector, matching the index.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return A handle to the store, to be released with `usearch_store_free`.
+ */
+USEARCH_EXPORT usearch_store_t usearch_store_init_callback(                     //
+    usearch_fetch_t fetch, void* state, usearch_scalar_kind_t kind, size_t dimensions, usearch_error_t* error);
+
+/**
+ *  @brief Frees the resources associated with a store, unmapping its file if it has one.
+ *  @param[in] store The handle to the store to be freed.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_store_free(usearch_store_t store, usearch_error_t* error);
+
+/**
+ *  @brief  Two-stage search for quantized indexes. Fetches `count * oversample` candidates by traversing the graph
+ *          with quantized distances, then re-ranks them with exact distances against the full-precision vectors
+ *          of `store`, using the metric kind of the index. Candidates missing from the store are dropped.
+ *
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data, which must match the store.
+ *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
+ *  @param[in] oversample How many candidates to fetch for every result, `0` is treated as `1`.
+ *  @param[in] store The full-precision vectors, see `usearch_store_map_file` and `usearch_store_init_callback`.
+ *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for up to `count` exact distances to nearest neighbors.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_search_rerank(                                   //
+    usearch_index_t index,                                                    //
+    void const* query_vector, usearch_scalar_kind_t query_kind, size_t count, //
+    size_t oversample, usearch_store_t store,                                 //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
 /**
  *  @brief Retrieves the vector associated with the given key from the index.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -407,6 +910,22 @@ USEARCH_EXPORT size_t usearch_get(                          //
     usearch_index_t index, usearch_key_t key, size_t count, //
     void* vector, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
 
+/**
+ *  @brief Retrieves the vectors of many keys at once into a single contiguous matrix, one row per key.
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] keys The keys of the vectors to retrieve.
+ *  @param[in] count Number of keys, which is also the number of rows in `vectors`.
+ *  @param[out] vectors Pointer to the matrix where the vectors will be copied. Rows of missing keys are zeroed.
+ *  @param[in] stride Number of bytes between the starts of consecutive rows in `vectors`.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[in] threads Upper bound on the number of threads to use, `0` to use every available core.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of keys found and exported to `vectors`.
+ */
+USEARCH_EXPORT size_t usearch_get_batch(                                     //
+    usearch_index_t index, usearch_key_t const* keys, size_t count,          //
+    void* vectors, size_t stride, usearch_scalar_kind_t vector_kind, size_t threads, usearch_error_t* error);
+
 /**
  *  @brief Removes the vector associated with the given key from the index.
  *  @param[inout] index The handle to the USearch index to be modified.
@@ -442,6 +961,52 @@ USEARCH_EXPORT usearch_distance_t usearch_distance(       //
     usearch_scalar_kind_t scalar_kind, size_t dimensions, //
     usearch_metric_kind_t metric_kind, usearch_error_t* error);
 
+/**
+ *  @brief Computes the distances from one vector to every row of a matrix, resolving the SIMD kernel once.
+ *  @param[in] query The vector to compare against.
+ *  @param[in] matrix Pointer to the first scalar of the matrix.
+ *  @param[in] count Number of vectors in the `matrix`.
+ *  @param[in] stride Number of bytes between starts of consecutive vectors in `matrix`.
+ *  @param[in] scalar_kind The scalar type used in the vectors.
+ *  @param[in] dimensions The number of dimensions in each vector.
+ *  @param[in] metric_kind The metric kind used for distance calculation between vectors.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, `0` to use all cores.
+ *              Small inputs are always computed on the calling thread.
+ *  @param[out] distances Output array for `count` distances, in the order of the rows.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_distances(                        //
+    void const* query, void const* matrix, size_t count, size_t stride, //
+    usearch_scalar_kind_t scalar_kind, size_t dimensions,     //
+    usearch_metric_kind_t metric_kind, size_t threads,        //
+    usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief Computes the distances from every query to every row of a matrix, resolving the SIMD kernel once.
+ *         The work is split into tiles of rows small enough to stay in cache while all queries pass over them.
+ *  @param[in] queries Pointer to the first scalar of the queries matrix.
+ *  @param[in] queries_count Number of vectors in the `queries` set.
+ *  @param[in] queries_stride Number of bytes between starts of consecutive vectors in `queries`.
+ *  @param[in] matrix Pointer to the first scalar of the matrix.
+ *  @param[in] count Number of vectors in the `matrix`.
+ *  @param[in] stride Number of bytes between starts of consecutive vectors in `matrix`.
+ *  @param[in] scalar_kind The scalar type used in the vectors.
+ *  @param[in] dimensions The number of dimensions in each vector.
+ *  @param[in] metric_kind The metric kind used for distance calculation between vectors.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, `0` to use all cores.
+ *  @param[out] distances Output matrix of `queries_count` rows of `count` distances. Each row of the
+ *              matrix must be contiguous in memory, but different rows can be separated by `distances_stride` bytes.
+ *  @param[in] distances_stride Number of bytes between starts of consecutive rows of `distances`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_distances_matrix(                            //
+    void const* queries, size_t queries_count, size_t queries_stride, //
+    void const* matrix, size_t count, size_t stride,                  //
+    usearch_scalar_kind_t scalar_kind, size_t dimensions,             //
+    usearch_metric_kind_t metric_kind, size_t threads,                //
+    usearch_distance_t* distances, size_t distances_stride,           //
+    usearch_error_t* error);
+
 /**
  *  @brief Multi-threaded many-to-many exact nearest neighbors search for equi-dimensional vectors.
  *  @param[in] dataset Pointer to the first scalar of the dataset matrix.
@@ -454,7 +1019,8 @@ USEARCH_EXPORT usearch_distance_t usearch_distance(       //
  *  @param[in] dimensions The number of dimensions in each vector.
  *  @param[in] metric_kind The metric kind used for distance calculation between vectors.
  *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
- *  @param[in] threads Upper bound for the number of CPU threads to use.
+ *              Only the first `min(count, dataset_size)` entries of every output row are written.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, `0` to use all cores.
  *  @param[out] keys Output matrix for `queries_size * count` nearest neighbors keys. Each row of the
  *              matrix must be contiguous in memory, but different rows can be separated by `keys_stride` bytes.
  *  @param[in] keys_stride Number of bytes between starts of consecutive rows od scalars in `keys`.
@@ -480,6 +1046,234 @@ USEARCH_EXPORT void usearch_exact_search(                            //
 USEARCH_EXPORT void usearch_clear(usearch_index_t index,
                                   usearch_error_t* error);
 
+/**
+ *  @brief Reclaims the slots of removed vectors. First relinks the neighbors of every removed node,
+ *         so that the graph stays connected without them, then rebuilds the index without the dead slots.
+ *  @param[inout] index The handle to the USearch index to be compacted.
+ *  @param[in] threads Upper bound on the number of threads to use, `0` to use every available core.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_compact(usearch_index_t index, size_t threads, usearch_error_t* error);
+
+/**
+ *  @brief  Attaches a write-ahead log to the index, so that durability costs I/O proportional to the changes
+ *          instead of a full `usearch_save`. Records already in the file are first replayed over the index,
+ *          which should hold the last snapshot by then, and a torn record left by a crash is discarded.
+ *          From then on, every successful `usearch_add`, `usearch_add_batch`, `usearch_remove`, `usearch_rename`
+ *          and `usearch_clear` appends a record before returning. Records are flushed to the operating system
+ *          right away, surviving a crash of the process, and synced to the storage device in batches.
+ *          Other operations on this index must not run concurrently.
+ *  @param[inout] index The handle to the USearch index, loaded from the last snapshot.
+ *  @param[in] path The file path of the log, created if missing.
+ *  @param[in] sync_every Number of records after which the log is synced to the storage device,
+ *              `1` to sync every operation, `0` to only sync in `usearch_wal_sync` and checkpoints.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of records replayed.
+ */
+USEARCH_EXPORT size_t usearch_wal_open(usearch_index_t index, char const* path, size_t sync_every,
+                                       usearch_error_t* error);
+
+/**
+ *  @brief Syncs the records appended so far to the storage device.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *              Also reports the first failure of a background checkpoint since the last call.
+ */
+USEARCH_EXPORT void usearch_wal_sync(usearch_index_t index, usearch_error_t* error);
+
+/**
+ *  @brief Syncs and detaches the log, so that further changes are no longer recorded.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_wal_close(usearch_index_t index, usearch_error_t* error);
+
+/**
+ *  @brief  Saves a full snapshot of the index and empties its log. The snapshot is written next to `path` and
+ *          atomically moved over it once synced, so a crash leaves either the old snapshot with the whole log,
+ *          or the new one, still with the whole log if the crash came before it was emptied. Replaying that log
+ *          again is harmless with key lookups, where every add replaces its key, but duplicates the logged
+ *          vectors of `multi` indexes and of indexes without key lookups.
+ *          In the thread-safe mode changes wait until the snapshot is written, while searches go on.
+ *          Otherwise the caller must keep all other changes to the index apart from the checkpoint.
+ *  @param[in] index The handle to the USearch index to be saved.
+ *  @param[in] path The file path of the snapshot.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_checkpoint(usearch_index_t index, char const* path, usearch_error_t* error);
+
+/**
+ *  @brief  Runs `usearch_checkpoint` periodically on a background thread, until called again or the index is freed.
+ *          Requires the index to be created with `usearch_init_options_t::thread_safe`. Failures are reported by
+ *          the next `usearch_wal_sync`.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[in] path The file path of the snapshot.
+ *  @param[in] interval_ms Milliseconds between checks, `0` to stop checkpointing.
+ *  @param[in] min_records Number of logged records below which a check skips the checkpoint.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_checkpoint_every(usearch_index_t index, char const* path, size_t interval_ms,
+                                             size_t min_records, usearch_error_t* error);
+
+/**
+ *  @brief  Starts a request queue owned by the index, for callers that must not block on searches and insertions,
+ *          like coroutines. A dispatcher thread takes up to `batch` pending requests at a time and answers them
+ *          together on at most `threads` threads, so the index is locked and grown once per micro-batch, and the
+ *          number of threads touching the index stays bounded however many callers there are.
+ *          Requests in flight together run concurrently, in no particular order.
+ *          Replaces a running queue the same way as `usearch_queue_free`.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[in] depth Number of pending requests above which submissions are rejected.
+ *  @param[in] batch Upper bound on the number of requests answered together.
+ *  @param[in] threads Upper bound on the number of threads answering a batch, the dispatcher included,
+ *              `0` to use every search context.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_queue_init(usearch_index_t index, size_t depth, size_t batch, size_t threads,
+                                       usearch_error_t* error);
+
+/**
+ *  @brief  Stops the request queue of the index, once the pending requests are answered.
+ *          Freeing the index does the same. Racing submissions either get queued first or fail.
+ *          Called from a completion, it doesn't wait for the dispatcher, which stops once the pending requests are
+ *          answered. The index must not be freed from a completion.
+ *  @param[inout] index The handle to the USearch index.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_queue_free(usearch_index_t index, usearch_error_t* error);
+
+/**
+ *  @brief  Queues a kANN search without waiting for it. The query is copied, so it can be reused right away.
+ *  @param[in] index The handle to the USearch index, with a queue started by `usearch_queue_init`.
+ *  @param[in] query Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
+ *  @param[in] searched Called with the neighbors once found, unless the request is rejected.
+ *  @param[in] state Passed to `searched` as is.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return `false` if `depth` requests are already pending, leaving backpressure to the caller.
+ */
+USEARCH_EXPORT bool usearch_submit_search(                                                        //
+    usearch_index_t index, void const* query, usearch_scalar_kind_t query_kind, size_t count, //
+    usearch_searched_t searched, void* state, usearch_error_t* error);
+
+/**
+ *  @brief  Queues an insertion without waiting for it. The vector is copied, so it can be reused right away.
+ *  @param[inout] index The handle to the USearch index, with a queue started by `usearch_queue_init`.
+ *  @param[in] key The key associated with the vector.
+ *  @param[in] vector Pointer to the vector data.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[in] added Called once the vector is added, unless the request is rejected.
+ *  @param[in] state Passed to `added` as is.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return `false` if `depth` requests are already pending, leaving backpressure to the caller.
+ */
+USEARCH_EXPORT bool usearch_submit_add(                                                              //
+    usearch_index_t index, usearch_key_t key, void const* vector, usearch_scalar_kind_t vector_kind, //
+    usearch_added_t added, void* state, usearch_error_t* error);
+
+/**
+ *  @brief Initializes a sharded index, made of several independent dense indexes with the same configuration.
+ *  Every key is routed to one shard by its hash. Adds and searches fan out to the shards on a pool of threads
+ *  kept alive for the lifetime of the sharded index.
+ *  @param[in] options Configuration options shared by every shard.
+ *  @param[in] shards Number of shards, at least one.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return A handle to the sharded index, or `NULL` on failure.
+ */
+USEARCH_EXPORT usearch_sharded_t usearch_sharded_init(usearch_init_options_t* options, size_t shards,
+                                                      usearch_error_t* error);
+
+/**
+ *  @brief Frees the resources associated with a sharded index, including its shards and threads.
+ *  @param[in] sharded The handle to the sharded index to be freed.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_sharded_free(usearch_sharded_t sharded, usearch_error_t* error);
+
+/**
+ *  @brief Reports the number of shards.
+ *  @param[in] sharded The handle to the sharded index to be queried.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT size_t usearch_sharded_count(usearch_sharded_t sharded, usearch_error_t* error);
+
+/**
+ *  @brief Exposes one shard as a regular index, owned by the sharded index. It can be saved, loaded or viewed
+ *  with `usearch_save`, `usearch_load` and `usearch_view`, to rebuild and swap shards one at a time.
+ *  @param[in] sharded The handle to the sharded index.
+ *  @param[in] shard Zero-based number of the shard.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return The shard, or `NULL` if the number is out of range.
+ */
+USEARCH_EXPORT usearch_index_t usearch_sharded_shard(usearch_sharded_t sharded, size_t shard,
+                                                     usearch_error_t* error);
+
+/**
+ *  @brief Reports the total number of vectors across all shards.
+ *  @param[in] sharded The handle to the sharded index to be queried.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT size_t usearch_sharded_size(usearch_sharded_t sharded, usearch_error_t* error);
+
+/**
+ *  @brief Adds a vector to the shard its key is routed to.
+ *  @param[inout] sharded The handle to the sharded index.
+ *  @param[in] key The key associated with the vector.
+ *  @param[in] vector Pointer to the vector data.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_sharded_add(usearch_sharded_t sharded, usearch_key_t key, void const* vector,
+                                        usearch_scalar_kind_t vector_kind, usearch_error_t* error);
+
+/**
+ *  @brief Adds a batch of vectors, inserting into all shards in parallel. Shards with a write-ahead log
+ *  log the rows that went to them, as `usearch_add_batch` would.
+ *  @param[inout] sharded The handle to the sharded index.
+ *  @param[in] keys The keys associated with each vector.
+ *  @param[in] vectors Pointer to the first vector, laid out row after row.
+ *  @param[in] count Number of vectors, which is also the number of keys.
+ *  @param[in] stride Number of bytes between the starts of consecutive vectors.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_sharded_add_batch(                                          //
+    usearch_sharded_t sharded, usearch_key_t const* keys, void const* vectors, size_t count, //
+    size_t stride, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
+
+/**
+ *  @brief Removes the vector associated with the given key from its shard.
+ *  @param[inout] sharded The handle to the sharded index.
+ *  @param[in] key The key of the vector to be removed.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of vectors found under that name and dropped from the index.
+ */
+USEARCH_EXPORT size_t usearch_sharded_remove(usearch_sharded_t sharded, usearch_key_t key, usearch_error_t* error);
+
+/**
+ *  @brief Checks if the sharded index contains a vector with a specific key.
+ *  @param[in] sharded The handle to the sharded index.
+ *  @param[in] key The key to be checked.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT bool usearch_sharded_contains(usearch_sharded_t sharded, usearch_key_t key, usearch_error_t* error);
+
+/**
+ *  @brief Searches every shard in parallel and merges their nearest neighbors into one list.
+ *  @param[in] sharded The handle to the sharded index to be queried.
+ *  @param[in] query Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
+ *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for up to `count` distances to nearest neighbors, in ascending order.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_sharded_search(                                                        //
+    usearch_sharded_t sharded, void const* query, usearch_scalar_kind_t query_kind, size_t count, //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,7 +7,9 @@ public class NativeBridge {
                                                      long connectivity,
                                                      long expansion_add,
                                                      long expansion_search,
-                                                     boolean multi) throws RuntimeException;
+                                                     boolean multi,
+                                                     boolean thread_safe,
+                                                     int key_lookups) throws RuntimeException;
 
     public native long usearch_init(long options_ptr) throws RuntimeException;
 
@@ -29,6 +31,8 @@ public class NativeBridge {
 
     public native long usearch_memory_usage(long index_ptr);
 
+    public native void usearch_memory_breakdown(long index_ptr, long[] out);
+
     public native long usearch_serialized_length(long index_ptr);
 
     public native long usearch_dimensions(long index_ptr);
@@ -55,16 +59,117 @@ public class NativeBridge {
 
     public native byte[][] usearch_get_b1(long index_ptr, long key, long count);
 
+    public native void usearch_add_batch_f32(long index_ptr, long[] keys, float[] f32_matrix, long threads);
+
+    public native void usearch_add_batch_f64(long index_ptr, long[] keys, double[] f64_matrix, long threads);
+
+    public native void usearch_add_batch_f16(long index_ptr, long[] keys, short[] f16_matrix, long threads);
+
+    public native void usearch_add_batch_i8(long index_ptr, long[] keys, byte[] i8_matrix, long threads);
+
+    public native void usearch_add_batch_b1(long index_ptr, long[] keys, byte[] b1_matrix, long threads);
+
+    public native long usearch_get_batch_f32(long index_ptr, long[] keys, float[] f32_matrix, long threads);
+
+    public native long usearch_get_batch_f64(long index_ptr, long[] keys, double[] f64_matrix, long threads);
+
+    public native long usearch_get_batch_f16(long index_ptr, long[] keys, short[] f16_matrix, long threads);
+
+    public native long usearch_get_batch_i8(long index_ptr, long[] keys, byte[] i8_matrix, long threads);
+
+    public native long usearch_get_batch_b1(long index_ptr, long[] keys, byte[] b1_matrix, long threads);
+
     public native long usearch_search(long index_ptr, float[] query, int count, long[] keys, float[] distances);
 
+    public native long usearch_search_f64(long index_ptr, double[] query, int count, long[] keys, float[] distances);
+
+    public native long usearch_search_f16(long index_ptr, short[] query, int count, long[] keys, float[] distances);
+
+    public native long usearch_search_i8(long index_ptr, byte[] query, int count, long[] keys, float[] distances);
+
+    public native long usearch_search_b1(long index_ptr, byte[] query, int count, long[] keys, float[] distances);
+
+    public native long usearch_filter_init(int kind, long[] keys, boolean exclude);
+
+    public native void usearch_filter_free(long filter_ptr);
+
+    public native long usearch_search_filter_f32(long index_ptr, float[] query, int count, long filter_ptr, long[] keys,
+                                               float[] distances);
+
+    public native long usearch_search_filter_f64(long index_ptr, double[] query, int count, long filter_ptr, long[] keys,
+                                               float[] distances);
+
+    public native long usearch_search_filter_f16(long index_ptr, short[] query, int count, long filter_ptr, long[] keys,
+                                               float[] distances);
+
+    public native long usearch_search_filter_i8(long index_ptr, byte[] query, int count, long filter_ptr, long[] keys,
+                                               float[] distances);
+
+    public native long usearch_search_filter_b1(long index_ptr, byte[] query, int count, long filter_ptr, long[] keys,
+                                               float[] distances);
+
+    public native long usearch_store_map_file(String file_path, int kind, long dimensions);
+
+    public native void usearch_store_free(long store_ptr);
+
+    public native long usearch_search_rerank(long index_ptr, Object query, int kind, int count, long oversample,
+                                             long store_ptr, VectorFetch fetch, long[] keys, float[] distances);
+
+    public native void usearch_add_buffer(long index_ptr, long key, java.nio.Buffer vec, long offset, long length,
+                                          int kind);
+
+    public native long usearch_search_buffer(long index_ptr, java.nio.Buffer query, long offset, long length, int kind,
+                                             int count, long[] keys, float[] distances);
+
+    public native long usearch_search_batch(long index_ptr, float[] queries, int queries_count, int count, long threads,
+                                            long[] keys, float[] distances, long[] counts);
+
+    public native long usearch_range_search(long index_ptr, float[] query, float max_distance, int max_results,
+                                            long[] keys, float[] distances);
+
+    public native long usearch_search_grouped(long index_ptr, float[] query, int count, int aggregation, long top_m,
+                                              long[] keys, float[] distances);
+
+    public native long usearch_range_search_batch(long index_ptr, float[] queries, int queries_count,
+                                                  float max_distance, int max_results, long threads, long[] keys,
+                                                  float[] distances, long[] counts);
+
+    public native void usearch_exact_search(float[] dataset, float[] queries, long dimensions, int metric_k, int count,
+                                            long threads, long[] keys, float[] distances);
+
+    public native void usearch_distances(float[] query, float[] matrix, int metric_k, long threads, float[] distances);
+
+    public native void usearch_distances_matrix(float[] queries, float[] matrix, long dimensions, int metric_k,
+                                                long threads, float[] distances);
+
+    public native float[] usearch_distances_buffer(java.nio.Buffer queries, long queries_offset, long queries_length,
+                                                   java.nio.Buffer matrix, long matrix_offset, long matrix_length,
+                                                   long dimensions, int kind, int metric_k, long threads);
+
     public native boolean usearch_contains(long index_ptr, long key);
 
     public native void usearch_reserve(long ptr, long capacity);
 
+    public native void usearch_change_growth_policy(long ptr, float factor, long min_step);
+
     public native long usearch_size(long ptr);
 
     public native long usearch_capacity(long ptr);
 
+    public native long usearch_tombstones(long ptr);
+
+    public native void usearch_compact(long ptr, long threads);
+
+    public native void usearch_enable_stats(long ptr, boolean enabled);
+
+    public native void usearch_stats(long ptr, long[] out);
+
+    public native void usearch_reset_stats(long ptr);
+
+    public native void usearch_enable_cache(long ptr, long capacity);
+
+    public native void usearch_cache_stats(long ptr, long[] out);
+
     public native void usearch_save_file(long ptr, String file_path);
 
     public native void usearch_save_buffer(long ptr, byte[] buffer);
@@ -72,4 +177,49 @@ public class NativeBridge {
     public native void usearch_load_file(long ptr, String file_path);
 
     public native void usearch_load_buffer(long ptr, byte[] buffer);
+
+    public native void usearch_save_stream(long ptr, StreamCallback write, byte[] buffer);
+
+    public native void usearch_load_stream(long ptr, StreamCallback read, byte[] buffer);
+
+    public native void usearch_view_file(long ptr, String file_path, int advice);
+
+    public native void usearch_load_huge_pages(long ptr, String file_path);
+
+    public native long usearch_wal_open(long ptr, String file_path, long sync_every);
+
+    public native void usearch_wal_sync(long ptr);
+
+    public native void usearch_wal_close(long ptr);
+
+    public native void usearch_checkpoint(long ptr, String file_path);
+
+    public native void usearch_checkpoint_every(long ptr, String file_path, long interval_ms, long min_records);
+
+    public native void usearch_queue_init(long ptr, long depth, long batch, long threads);
+
+    public native void usearch_queue_free(long ptr);
+
+    public native boolean usearch_submit_search(long ptr, float[] query, int count, QueueCallback callback);
+
+    public native boolean usearch_submit_add(long ptr, long key, float[] f32_vec, QueueCallback callback);
+
+    public native long usearch_sharded_init(long options_ptr, long shards);
+
+    public native void usearch_sharded_free(long sharded_ptr);
+
+    public native long usearch_sharded_shard(long sharded_ptr, long shard);
+
+    public native long usearch_sharded_size(long sharded_ptr);
+
+    public native void usearch_sharded_add(long sharded_ptr, long key, float[] f32_vec);
+
+    public native void usearch_sharded_add_batch(long sharded_ptr, long[] keys, float[] f32_matrix);
+
+    public native void usearch_sharded_remove(long sharded_ptr, long key);
+
+    public native boolean usearch_sharded_contains(long sharded_ptr, long key);
+
+    public native long usearch_sharded_search(long sharded_ptr, float[] query, int count, long[] keys,
+                                              float[] distances);
 }
@@ -0,0 +1,14 @@
+package usearch;
+
+/**
+ * Completion of a request submitted with {@link NativeBridge#usearch_submit_search}
+ * or {@link NativeBridge#usearch_submit_add}, called once on the dispatcher thread of the request queue.
+ */
+public interface QueueCallback {
+    /**
+     * @param keys      the neighbors found, or {@code null} for insertions and failures.
+     * @param distances the distances to the neighbors, or {@code null} for insertions and failures.
+     * @param error     the error message, or {@code null} on success.
+     */
+    void completed(long[] keys, float[] distances, String error);
+}
@@ -0,0 +1,13 @@
+package usearch;
+
+/**
+ * Moves serialized bytes between {@link NativeBridge} and a managed stream.
+ */
+public interface StreamCallback {
+    /**
+     * Writes the first {@code length} bytes of {@code buffer}, or reads up to {@code length} bytes into it.
+     *
+     * @return number of bytes transferred, non-positive at the end of the stream.
+     */
+    int transfer(byte[] buffer, int length);
+}
@@ -0,0 +1,13 @@
+package usearch;
+
+/**
+ * Reads full-precision vectors by key for {@link NativeBridge#usearch_search_rerank}.
+ */
+public interface VectorFetch {
+    /**
+     * Copies the vector of {@code key} into {@code vector}.
+     *
+     * @return whether the vector was found.
+     */
+    boolean fetch(long key, float[] vector);
+}
@@ -0,0 +1,5 @@
+package usearch
+
+actual enum class Aggregation(val nativeEnum: Int) {
+    Min(0), Mean(1), TopSum(2)
+}
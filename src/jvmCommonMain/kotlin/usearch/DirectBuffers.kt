@@ -0,0 +1,61 @@
+package usearch
+
+import java.nio.Buffer
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.CharBuffer
+import java.nio.DoubleBuffer
+import java.nio.FloatBuffer
+import java.nio.IntBuffer
+import java.nio.LongBuffer
+import java.nio.ShortBuffer
+
+/**
+ * Adds a vector read from a direct buffer, without copying it onto the heap.
+ * @see Index.CommonIndexQuery.add
+ */
+fun IndexQuery<*>.add(key: ULong, vec: Buffer) = (this as Index.CommonIndexQuery<*>).add(key, vec)
+
+/**
+ * Searches with a query read from a direct buffer, without copying it onto the heap.
+ * @see Index.CommonIndexQuery.search
+ */
+fun IndexQuery<*>.search(query: Buffer, count: Int): Matches =
+    (this as Index.CommonIndexQuery<*>).search(query, count)
+
+internal val Buffer.elementBytes: Int
+    get() = when (this) {
+        is ByteBuffer -> Byte.SIZE_BYTES
+        is ShortBuffer, is CharBuffer -> Short.SIZE_BYTES
+        is IntBuffer, is FloatBuffer -> Int.SIZE_BYTES
+        is LongBuffer, is DoubleBuffer -> Long.SIZE_BYTES
+        else -> throw IllegalArgumentException("Unsupported buffer type ${javaClass.name}.")
+    }
+
+internal val Buffer.byteOffset: Long
+    get() = position().toLong() * elementBytes
+
+internal val Buffer.remainingBytes: Long
+    get() = remaining().toLong() * elementBytes
+
+private val Buffer.order: ByteOrder?
+    get() = when (this) {
+        is ShortBuffer -> order()
+        is CharBuffer -> order()
+        is IntBuffer -> order()
+        is FloatBuffer -> order()
+        is LongBuffer -> order()
+        is DoubleBuffer -> order()
+        else -> null
+    }
+
+internal fun Buffer.checkDirect(): Buffer {
+    if (!isDirect) {
+        throw IllegalArgumentException("Buffer is not direct.")
+    }
+    val order = order
+    if (order != null && order != ByteOrder.nativeOrder()) {
+        throw IllegalArgumentException("Buffer is in $order, but native order is ${ByteOrder.nativeOrder()}.")
+    }
+    return this
+}
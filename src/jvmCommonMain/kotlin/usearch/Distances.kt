@@ -0,0 +1,46 @@
+package usearch
+
+import java.nio.Buffer
+
+actual fun distances(query: FloatArray, matrix: FloatArray, metric: MetricKind, threads: ULong): FloatArray {
+    val rows = checkMatrix(matrix, query.size, "matrix")
+    val distances = FloatArray(rows)
+    NativeMethods.bridge.usearch_distances(query, matrix, metric.nativeEnum, threads.toLong(), distances)
+    return distances
+}
+
+actual fun distanceMatrix(
+    queries: FloatArray,
+    matrix: FloatArray,
+    dimensions: ULong,
+    metric: MetricKind,
+    threads: ULong
+): FloatArray {
+    val queriesRows = checkMatrix(queries, dimensions.toInt(), "queries")
+    val rows = checkMatrix(matrix, dimensions.toInt(), "matrix")
+    val distances = FloatArray(queriesRows * rows)
+    NativeMethods.bridge.usearch_distances_matrix(
+        queries, matrix, dimensions.toLong(), metric.nativeEnum, threads.toLong(), distances
+    )
+    return distances
+}
+
+/**
+ * Same as [distanceMatrix], but reads the vectors straight from direct buffers, from their positions to their limits,
+ * without copying them onto the heap. A single query gives one distance per row of [matrix].
+ * @param kind how the scalars in both buffers are interpreted.
+ * @throws IllegalArgumentException if a buffer is not direct, not in native byte order,
+ * or does not hold a whole number of vectors.
+ */
+fun distanceMatrix(
+    queries: Buffer,
+    matrix: Buffer,
+    dimensions: ULong,
+    kind: ScalarKind,
+    metric: MetricKind,
+    threads: ULong = 0u
+): FloatArray = NativeMethods.bridge.usearch_distances_buffer(
+    queries.checkDirect(), queries.byteOffset, queries.remainingBytes,
+    matrix.checkDirect(), matrix.byteOffset, matrix.remainingBytes,
+    dimensions.toLong(), kind.nativeEnum, metric.nativeEnum, threads.toLong()
+)
@@ -0,0 +1,28 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+actual fun exactSearch(
+    dataset: FloatArray,
+    queries: FloatArray,
+    dimensions: ULong,
+    count: Int,
+    metric: MetricKind,
+    threads: ULong
+): List<Matches> {
+    val datasetRows = checkMatrix(dataset, dimensions.toInt(), "dataset")
+    val queriesRows = checkMatrix(queries, dimensions.toInt(), "queries")
+    if (datasetRows == 0 || queriesRows == 0) {
+        return List(queriesRows) { Matches(emptyList(), emptyList()) }
+    }
+    val found = minOf(count, datasetRows)
+    val keys = LongArray(queriesRows * count)
+    val distances = FloatArray(queriesRows * count)
+    NativeMethods.bridge.usearch_exact_search(
+        dataset, queries, dimensions.toLong(), metric.nativeEnum, count, threads.toLong(), keys, distances
+    )
+    return List(queriesRows) { row ->
+        val from = row * count
+        Matches(keys.copyOfRange(from, from + found).asULongArray(), distances.copyOfRange(from, from + found), found)
+    }
+}
@@ -1,27 +1,24 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
 package usearch
 
+import java.nio.Buffer
+import java.nio.FloatBuffer
+import kotlin.time.Duration
+
 actual class Index(
     private val ptr: Long,
     private var _metricKind: MetricKind
 ) {
-    actual constructor(options: IndexOptions) : this({
-        val opts = NativeMethods.bridge.usearch_new_index_opts(
-            options.dimensions.toLong(),
-            options.metric.nativeEnum,
-            options.quantization.nativeEnum,
-            options.connectivity.toLong(),
-            options.expansionAdd.toLong(),
-            options.expansionSearch.toLong(),
-            options.multi
-        )
-        try {
-            val ptr = NativeMethods.bridge.usearch_init(opts)
-            NativeMethods.bridge.usearch_reserve(ptr, INITIAL_CAPACITY)
-            ptr
-        } finally {
-            NativeMethods.bridge.release_index_opts(opts)
-        }
-    }(), options.metric)
+    private var _statsEnabled = false
+    private var _cacheCapacity = 0uL
+
+    actual constructor(options: IndexOptions) : this(options.useNative { opts ->
+        val ptr = NativeMethods.bridge.usearch_init(opts)
+        NativeMethods.bridge.usearch_reserve(ptr, INITIAL_CAPACITY)
+        NativeMethods.bridge.usearch_change_growth_policy(ptr, GROWTH_FACTOR, INCREMENTAL_CAPACITY)
+        ptr
+    }, options.metric)
 
     actual var expansionAdd: ULong
         get() = NativeMethods.bridge.usearch_expansion_add(ptr).toULong()
@@ -38,8 +35,8 @@ actual class Index(
     actual var metricKind: MetricKind
         get() = _metricKind
         set(value) {
+            NativeMethods.bridge.usearch_change_metric_kind(ptr, value.nativeEnum.toLong())
             _metricKind = value
-
         }
 
     actual val hardwareAcceleration: String?
@@ -52,10 +49,22 @@ actual class Index(
         NativeMethods.bridge.usearch_remove(ptr, key.toLong())
     }
 
+    actual fun compact(threads: ULong) {
+        NativeMethods.bridge.usearch_compact(ptr, threads.toLong())
+    }
+
+    actual fun resetStats() {
+        NativeMethods.bridge.usearch_reset_stats(ptr)
+    }
+
     actual fun reserve(capacity: ULong) {
         NativeMethods.bridge.usearch_reserve(ptr, capacity.toLong())
     }
 
+    actual fun changeGrowthPolicy(factor: Float, minStep: ULong) {
+        NativeMethods.bridge.usearch_change_growth_policy(ptr, factor, minStep.toLong())
+    }
+
     actual val asF32: IndexQuery<FloatArray> by lazy(::F32Q)
 
     actual val asF64: IndexQuery<DoubleArray> by lazy(::F64Q)
@@ -70,10 +79,93 @@ actual class Index(
         val keys = LongArray(count)
         val distances = FloatArray(count)
         val size = NativeMethods.bridge.usearch_search(ptr, query, count, keys, distances).toInt()
-        return Matches(
-            keys.slice(0 until size).map { it.toULong() },
-            distances.slice(0 until size)
+        return Matches(keys.asULongArray(), distances, size)
+    }
+
+    actual fun search(query: FloatArray, count: Int, filter: KeyFilter): Matches = asF32.search(query, count, filter)
+
+    actual fun search(query: FloatArray, buffer: SearchBuffer): Int = asF32.search(query, buffer)
+
+    actual fun searchReranked(query: FloatArray, count: Int, store: VectorStore, oversample: Int): Matches {
+        if (oversample < 1) {
+            throw IllegalArgumentException("Oversample $oversample is less than 1.")
+        }
+        if (query.size.toULong() != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        val typedQuery: Any = if (store.kind == ScalarKind.F64) DoubleArray(query.size) { query[it].toDouble() } else query
+        val keys = LongArray(count)
+        val distances = FloatArray(count)
+        val size = NativeMethods.bridge.usearch_search_rerank(
+            ptr, typedQuery, store.kind.nativeEnum, count, oversample.toLong(), store.ptr, store.fetch, keys, distances
+        ).toInt()
+        return Matches(keys.asULongArray(), distances, size)
+    }
+
+    /**
+     * Same as [search], but reads the query straight from a direct buffer,
+     * starting at its position, without copying it onto the heap.
+     * @throws IllegalArgumentException if [query] is not direct, not in native byte order,
+     * or has fewer remaining floats than [dimensions].
+     */
+    fun search(query: FloatBuffer, count: Int): Matches = asF32.search(query, count)
+
+    actual fun searchBatch(queries: FloatArray, count: Int, threads: ULong): List<Matches> {
+        val dimensions = dimensions.toInt()
+        if (dimensions <= 0 || queries.size % dimensions != 0) {
+            throw IllegalArgumentException("Cannot split ${queries.size} scalars into $dimensions-dimensional queries.")
+        }
+        val rows = queries.size / dimensions
+        val keys = LongArray(rows * count)
+        val distances = FloatArray(rows * count)
+        val counts = LongArray(rows)
+        NativeMethods.bridge.usearch_search_batch(ptr, queries, rows, count, threads.toLong(), keys, distances, counts)
+        return List(rows) { row ->
+            val from = row * count
+            val size = counts[row].toInt()
+            Matches(keys.copyOfRange(from, from + size).asULongArray(), distances.copyOfRange(from, from + size), size)
+        }
+    }
+
+    actual fun searchWithin(query: FloatArray, radius: Float, maxResults: Int): Matches {
+        if (query.size.toULong() != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        val keys = LongArray(maxResults)
+        val distances = FloatArray(maxResults)
+        val size = NativeMethods.bridge.usearch_range_search(ptr, query, radius, maxResults, keys, distances).toInt()
+        return Matches(keys.asULongArray(), distances, size)
+    }
+
+    actual fun searchGrouped(query: FloatArray, count: Int, aggregation: Aggregation, topM: Int): Matches {
+        if (query.size.toULong() != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        val keys = LongArray(count)
+        val distances = FloatArray(count)
+        val size = NativeMethods.bridge.usearch_search_grouped(
+            ptr, query, count, aggregation.nativeEnum, topM.toLong(), keys, distances
+        ).toInt()
+        return Matches(keys.asULongArray(), distances, size)
+    }
+
+    actual fun searchWithinBatch(queries: FloatArray, radius: Float, maxResults: Int, threads: ULong): List<Matches> {
+        val dimensions = dimensions.toInt()
+        if (dimensions <= 0 || queries.size % dimensions != 0) {
+            throw IllegalArgumentException("Cannot split ${queries.size} scalars into $dimensions-dimensional queries.")
+        }
+        val rows = queries.size / dimensions
+        val keys = LongArray(rows * maxResults)
+        val distances = FloatArray(rows * maxResults)
+        val counts = LongArray(rows)
+        NativeMethods.bridge.usearch_range_search_batch(
+            ptr, queries, rows, radius, maxResults, threads.toLong(), keys, distances, counts
         )
+        return List(rows) { row ->
+            val from = row * maxResults
+            val size = counts[row].toInt()
+            Matches(keys.copyOfRange(from, from + size).asULongArray(), distances.copyOfRange(from, from + size), size)
+        }
     }
 
     actual operator fun contains(key: ULong): Boolean = NativeMethods.bridge.usearch_contains(ptr, key.toLong())
@@ -87,6 +179,47 @@ actual class Index(
     actual val memoryUsage: ULong
         get() = NativeMethods.bridge.usearch_memory_usage(ptr).toULong()
 
+    actual val memoryBreakdown: MemoryBreakdown
+        get() {
+            val values = LongArray(6)
+            NativeMethods.bridge.usearch_memory_breakdown(ptr, values)
+            return MemoryBreakdown(
+                values[0].toULong(), values[1].toULong(), values[2].toULong(),
+                values[3].toULong(), values[4].toULong(), values[5].toULong()
+            )
+        }
+
+    actual val tombstones: ULong
+        get() = NativeMethods.bridge.usearch_tombstones(ptr).toULong()
+
+    actual var statsEnabled: Boolean
+        get() = _statsEnabled
+        set(value) {
+            NativeMethods.bridge.usearch_enable_stats(ptr, value)
+            _statsEnabled = value
+        }
+
+    actual val stats: IndexStats
+        get() {
+            val values = LongArray(INDEX_STATS_LENGTH)
+            NativeMethods.bridge.usearch_stats(ptr, values)
+            return indexStatsOf(values.asULongArray())
+        }
+
+    actual var cacheCapacity: ULong
+        get() = _cacheCapacity
+        set(value) {
+            NativeMethods.bridge.usearch_enable_cache(ptr, value.toLong())
+            _cacheCapacity = value
+        }
+
+    actual val cacheStats: CacheStats
+        get() {
+            val values = LongArray(3)
+            NativeMethods.bridge.usearch_cache_stats(ptr, values)
+            return CacheStats(values[0].toULong(), values[1].toULong(), values[2].toULong())
+        }
+
     actual val serializedLength: ULong
         get() = NativeMethods.bridge.usearch_serialized_length(ptr).toULong()
 
@@ -94,6 +227,14 @@ actual class Index(
         NativeMethods.bridge.usearch_load_file(ptr, filePath)
     }
 
+    actual fun viewFile(filePath: String, advice: ViewAdvice) {
+        NativeMethods.bridge.usearch_view_file(ptr, filePath, advice.nativeEnum)
+    }
+
+    actual fun loadHugePages(filePath: String) {
+        NativeMethods.bridge.usearch_load_huge_pages(ptr, filePath)
+    }
+
     actual fun loadBuffer(buffer: ByteArray) {
         if (buffer.isEmpty()) {
             throw IllegalArgumentException("Cannot load from empty buffer.")
@@ -106,6 +247,18 @@ actual class Index(
         NativeMethods.bridge.usearch_save_file(ptr, filePath)
     }
 
+    actual fun saveStream(bufferSize: Int, write: (buffer: ByteArray, length: Int) -> Unit) {
+        val callback = StreamCallback { buffer, length ->
+            write(buffer, length)
+            length
+        }
+        NativeMethods.bridge.usearch_save_stream(ptr, callback, ByteArray(bufferSize))
+    }
+
+    actual fun loadStream(bufferSize: Int, read: (buffer: ByteArray, length: Int) -> Int) {
+        NativeMethods.bridge.usearch_load_stream(ptr, StreamCallback(read), ByteArray(bufferSize))
+    }
+
     actual fun saveBuffer(buffer: ByteArray) {
         if (buffer.isEmpty()) {
             throw IllegalArgumentException("Cannot save to empty buffer.")
@@ -113,6 +266,46 @@ actual class Index(
         NativeMethods.bridge.usearch_save_buffer(ptr, buffer)
     }
 
+    actual fun openLog(filePath: String, syncEvery: ULong): ULong =
+        NativeMethods.bridge.usearch_wal_open(ptr, filePath, syncEvery.toLong()).toULong()
+
+    actual fun syncLog() {
+        NativeMethods.bridge.usearch_wal_sync(ptr)
+    }
+
+    actual fun closeLog() {
+        NativeMethods.bridge.usearch_wal_close(ptr)
+    }
+
+    actual fun checkpoint(filePath: String) {
+        NativeMethods.bridge.usearch_checkpoint(ptr, filePath)
+    }
+
+    actual fun checkpointEvery(filePath: String, interval: Duration, minRecords: ULong) {
+        NativeMethods.bridge.usearch_checkpoint_every(ptr, filePath, interval.inWholeMilliseconds, minRecords.toLong())
+    }
+
+    internal actual fun startQueue(depth: Int, batchSize: Int, threads: ULong) {
+        NativeMethods.bridge.usearch_queue_init(ptr, depth.toLong(), batchSize.toLong(), threads.toLong())
+    }
+
+    internal actual fun stopQueue() {
+        NativeMethods.bridge.usearch_queue_free(ptr)
+    }
+
+    internal actual fun submitSearch(query: FloatArray, count: Int, done: (Result<Matches>) -> Unit): Boolean =
+        NativeMethods.bridge.usearch_submit_search(ptr, query, count) { keys, distances, error ->
+            done(
+                if (error == null) Result.success(Matches(keys.asULongArray(), distances, keys.size))
+                else Result.failure(USearchException(error))
+            )
+        }
+
+    internal actual fun submitAdd(key: ULong, vector: FloatArray, done: (Result<Unit>) -> Unit): Boolean =
+        NativeMethods.bridge.usearch_submit_add(ptr, key.toLong(), vector) { _, _, error ->
+            done(if (error == null) Result.success(Unit) else Result.failure(USearchException(error)))
+        }
+
     protected fun finalize() {
         NativeMethods.bridge.usearch_free(ptr)
     }
@@ -120,15 +313,30 @@ actual class Index(
     actual companion object {
         actual val INITIAL_CAPACITY: Long = 5L
         actual val INCREMENTAL_CAPACITY: Long = 5L
+        actual val GROWTH_FACTOR: Float = 2f
+        actual val STREAM_BUFFER_SIZE: Int = 64 * 1024
     }
 
-    inner class F32Q : CommonIndexQuery<FloatArray>() {
-        override fun isEmpty(vec: FloatArray): Boolean = vec.isEmpty()
+    inner class F32Q : CommonIndexQuery<FloatArray>(ScalarKind.F32) {
+        override fun sizeOf(vec: FloatArray): Int = vec.size
 
         override fun addNotEmpty(key: ULong, vec: FloatArray) {
             NativeMethods.bridge.usearch_add_f32(ptr, key.toLong(), vec)
         }
 
+        override fun addAllNotEmpty(keys: LongArray, matrix: FloatArray, threads: Long) {
+            NativeMethods.bridge.usearch_add_batch_f32(ptr, keys, matrix, threads)
+        }
+
+        override fun search(query: FloatArray, count: Int, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search(ptr, query, count, keys, distances)
+
+        override fun search(query: FloatArray, count: Int, filter: Long, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_filter_f32(ptr, query, count, filter, keys, distances)
+
+        override fun getAll(keys: LongArray, scalars: Int, threads: Long): FloatArray =
+            FloatArray(scalars).also { NativeMethods.bridge.usearch_get_batch_f32(ptr, keys, it, threads) }
+
         override fun get(key: ULong): FloatArray? =
             NativeMethods.bridge.usearch_get_f32(ptr, key.toLong(), 1).firstOrNull()
 
@@ -137,13 +345,26 @@ actual class Index(
                 .toList()
     }
 
-    inner class F64Q : CommonIndexQuery<DoubleArray>() {
-        override fun isEmpty(vec: DoubleArray): Boolean = vec.isEmpty()
+    inner class F64Q : CommonIndexQuery<DoubleArray>(ScalarKind.F64) {
+        override fun sizeOf(vec: DoubleArray): Int = vec.size
 
         override fun addNotEmpty(key: ULong, vec: DoubleArray) {
             NativeMethods.bridge.usearch_add_f64(ptr, key.toLong(), vec)
         }
 
+        override fun addAllNotEmpty(keys: LongArray, matrix: DoubleArray, threads: Long) {
+            NativeMethods.bridge.usearch_add_batch_f64(ptr, keys, matrix, threads)
+        }
+
+        override fun search(query: DoubleArray, count: Int, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_f64(ptr, query, count, keys, distances)
+
+        override fun search(query: DoubleArray, count: Int, filter: Long, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_filter_f64(ptr, query, count, filter, keys, distances)
+
+        override fun getAll(keys: LongArray, scalars: Int, threads: Long): DoubleArray =
+            DoubleArray(scalars).also { NativeMethods.bridge.usearch_get_batch_f64(ptr, keys, it, threads) }
+
         override fun get(key: ULong): DoubleArray? =
             NativeMethods.bridge.usearch_get_f64(ptr, key.toLong(), 1).firstOrNull()
 
@@ -152,13 +373,28 @@ actual class Index(
                 .toList()
     }
 
-    inner class F16Q : CommonIndexQuery<Float16Array>() {
-        override fun isEmpty(vec: Float16Array): Boolean = vec.isEmpty()
+    inner class F16Q : CommonIndexQuery<Float16Array>(ScalarKind.F16) {
+        override fun sizeOf(vec: Float16Array): Int = vec.size
 
         override fun addNotEmpty(key: ULong, vec: Float16Array) {
             NativeMethods.bridge.usearch_add_f16(ptr, key.toLong(), vec.toRawBits())
         }
 
+        override fun addAllNotEmpty(keys: LongArray, matrix: Float16Array, threads: Long) {
+            NativeMethods.bridge.usearch_add_batch_f16(ptr, keys, matrix.toRawBits(), threads)
+        }
+
+        override fun search(query: Float16Array, count: Int, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_f16(ptr, query.toRawBits(), count, keys, distances)
+
+        override fun search(query: Float16Array, count: Int, filter: Long, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_filter_f16(ptr, query.toRawBits(), count, filter, keys, distances)
+
+        override fun getAll(keys: LongArray, scalars: Int, threads: Long): Float16Array =
+            ShortArray(scalars)
+                .also { NativeMethods.bridge.usearch_get_batch_f16(ptr, keys, it, threads) }
+                .let(::Float16Array)
+
         override fun get(key: ULong): Float16Array? =
             NativeMethods.bridge.usearch_get_f16(ptr, key.toLong(), 1)
                 .firstOrNull()
@@ -169,13 +405,26 @@ actual class Index(
                 .map(::Float16Array)
     }
 
-    inner class I8Q : CommonIndexQuery<ByteArray>() {
-        override fun isEmpty(vec: ByteArray): Boolean = vec.isEmpty()
+    inner class I8Q : CommonIndexQuery<ByteArray>(ScalarKind.I8) {
+        override fun sizeOf(vec: ByteArray): Int = vec.size
 
         override fun addNotEmpty(key: ULong, vec: ByteArray) {
             NativeMethods.bridge.usearch_add_i8(ptr, key.toLong(), vec)
         }
 
+        override fun addAllNotEmpty(keys: LongArray, matrix: ByteArray, threads: Long) {
+            NativeMethods.bridge.usearch_add_batch_i8(ptr, keys, matrix, threads)
+        }
+
+        override fun search(query: ByteArray, count: Int, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_i8(ptr, query, count, keys, distances)
+
+        override fun search(query: ByteArray, count: Int, filter: Long, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_filter_i8(ptr, query, count, filter, keys, distances)
+
+        override fun getAll(keys: LongArray, scalars: Int, threads: Long): ByteArray =
+            ByteArray(scalars).also { NativeMethods.bridge.usearch_get_batch_i8(ptr, keys, it, threads) }
+
         override fun get(key: ULong): ByteArray? =
             NativeMethods.bridge.usearch_get_i8(ptr, key.toLong(), 1).firstOrNull()
 
@@ -184,13 +433,26 @@ actual class Index(
                 .toList()
     }
 
-    inner class B1Q : CommonIndexQuery<ByteArray>() {
-        override fun isEmpty(vec: ByteArray): Boolean = vec.isEmpty()
+    inner class B1Q : CommonIndexQuery<ByteArray>(ScalarKind.B1) {
+        override fun sizeOf(vec: ByteArray): Int = vec.size
 
         override fun addNotEmpty(key: ULong, vec: ByteArray) {
             NativeMethods.bridge.usearch_add_b1(ptr, key.toLong(), vec)
         }
 
+        override fun addAllNotEmpty(keys: LongArray, matrix: ByteArray, threads: Long) {
+            NativeMethods.bridge.usearch_add_batch_b1(ptr, keys, matrix, threads)
+        }
+
+        override fun search(query: ByteArray, count: Int, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_b1(ptr, query, count, keys, distances)
+
+        override fun search(query: ByteArray, count: Int, filter: Long, keys: LongArray, distances: FloatArray): Long =
+            NativeMethods.bridge.usearch_search_filter_b1(ptr, query, count, filter, keys, distances)
+
+        override fun getAll(keys: LongArray, scalars: Int, threads: Long): ByteArray =
+            ByteArray(scalars).also { NativeMethods.bridge.usearch_get_batch_b1(ptr, keys, it, threads) }
+
         override fun get(key: ULong): ByteArray? =
             NativeMethods.bridge.usearch_get_b1(ptr, key.toLong(), 1)
                 .firstOrNull()
@@ -200,18 +462,86 @@ actual class Index(
                 .toList()
     }
 
-    abstract inner class CommonIndexQuery<T> : IndexQuery<T> {
+    abstract inner class CommonIndexQuery<T>(val vectorKind: ScalarKind) : IndexQuery<T> {
         final override fun add(key: ULong, vec: T) {
-            if (isEmpty(vec)) {
+            if (sizeOf(vec) <= 0) {
                 throw IllegalArgumentException("Cannot add empty vector.")
             }
-            if (capacity < size + 1u) {
-                NativeMethods.bridge.usearch_reserve(ptr, INCREMENTAL_CAPACITY)
-            }
             addNotEmpty(key, vec)
         }
 
-        abstract fun isEmpty(vec: T): Boolean
+        final override fun addAll(keys: ULongArray, matrix: T, threads: ULong) {
+            if (keys.isEmpty()) {
+                return
+            }
+            val dimensions = dimensions.toInt()
+            val rowScalars = if (vectorKind == ScalarKind.B1) (dimensions + 7) / 8 else dimensions
+            val scalars = sizeOf(matrix)
+            if (scalars != keys.size * rowScalars) {
+                throw IllegalArgumentException(
+                    "Cannot split $scalars scalars into ${keys.size} $dimensions-dimensional vectors."
+                )
+            }
+            addAllNotEmpty(keys.asLongArray(), matrix, threads.toLong())
+        }
+
+        /**
+         * Adds a vector read from a direct buffer, starting at its position, without copying it onto the heap.
+         * The buffer's content is interpreted as scalars of [vectorKind], regardless of the buffer's element type.
+         * @throws IllegalArgumentException if [vec] is not direct, not in native byte order,
+         * or too short for one vector.
+         */
+        fun add(key: ULong, vec: Buffer) {
+            NativeMethods.bridge.usearch_add_buffer(
+                ptr, key.toLong(), vec.checkDirect(), vec.byteOffset, vec.remainingBytes, vectorKind.nativeEnum
+            )
+        }
+
+        /**
+         * Searches with a query read from a direct buffer, interpreted as scalars of [vectorKind].
+         * @see add
+         */
+        fun search(query: Buffer, count: Int): Matches {
+            val keys = LongArray(count)
+            val distances = FloatArray(count)
+            val size = NativeMethods.bridge.usearch_search_buffer(
+                ptr, query.checkDirect(), query.byteOffset, query.remainingBytes, vectorKind.nativeEnum,
+                count, keys, distances
+            ).toInt()
+            return Matches(keys.asULongArray(), distances, size)
+        }
+
+        final override fun search(query: T, count: Int): Matches {
+            val keys = LongArray(count)
+            val distances = FloatArray(count)
+            val size = search(query, count, keys, distances).toInt()
+            return Matches(keys.asULongArray(), distances, size)
+        }
+
+        final override fun search(query: T, count: Int, filter: KeyFilter): Matches {
+            val keys = LongArray(count)
+            val distances = FloatArray(count)
+            val size = search(query, count, filter.ptr, keys, distances).toInt()
+            return Matches(keys.asULongArray(), distances, size)
+        }
+
+        final override fun search(query: T, buffer: SearchBuffer): Int {
+            buffer.size = 0
+            buffer.size = search(query, buffer.capacity, buffer.keys, buffer.distances).toInt()
+            return buffer.size
+        }
+
+        final override fun getAll(keys: ULongArray, threads: ULong): T {
+            val dimensions = dimensions.toInt()
+            val rowScalars = if (vectorKind == ScalarKind.B1) (dimensions + 7) / 8 else dimensions
+            return getAll(keys.asLongArray(), keys.size * rowScalars, threads.toLong())
+        }
+
+        abstract fun sizeOf(vec: T): Int
+        abstract fun search(query: T, count: Int, keys: LongArray, distances: FloatArray): Long
+        abstract fun search(query: T, count: Int, filter: Long, keys: LongArray, distances: FloatArray): Long
+        abstract fun getAll(keys: LongArray, scalars: Int, threads: Long): T
         abstract fun addNotEmpty(key: ULong, vec: T)
+        abstract fun addAllNotEmpty(keys: LongArray, matrix: T, threads: Long)
     }
 }
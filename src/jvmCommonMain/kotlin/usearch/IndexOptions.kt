@@ -0,0 +1,23 @@
+package usearch
+
+/**
+ * Passes these options to [block] as a native `usearch_init_options_t`, released once it returns.
+ */
+internal inline fun <T> IndexOptions.useNative(block: (ptr: Long) -> T): T {
+    val opts = NativeMethods.bridge.usearch_new_index_opts(
+        dimensions.toLong(),
+        metric.nativeEnum,
+        quantization.nativeEnum,
+        connectivity.toLong(),
+        expansionAdd.toLong(),
+        expansionSearch.toLong(),
+        multi,
+        threadSafe,
+        keyLookups.nativeEnum
+    )
+    try {
+        return block(opts)
+    } finally {
+        NativeMethods.bridge.release_index_opts(opts)
+    }
+}
@@ -0,0 +1,15 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+actual enum class FilterKind(val nativeEnum: Int) {
+    Bitset(0), Sorted(1), Hash(2)
+}
+
+actual class KeyFilter actual constructor(keys: ULongArray, kind: FilterKind, exclude: Boolean) {
+    internal val ptr: Long = NativeMethods.bridge.usearch_filter_init(kind.nativeEnum, keys.asLongArray(), exclude)
+
+    protected fun finalize() {
+        NativeMethods.bridge.usearch_filter_free(ptr)
+    }
+}
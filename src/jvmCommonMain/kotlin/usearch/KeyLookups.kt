@@ -0,0 +1,5 @@
+package usearch
+
+actual enum class KeyLookups(val nativeEnum: Int) {
+    Hash(0), None(1), Identity(2)
+}
@@ -5,6 +5,9 @@ actual data class Matches(
     actual val keys: List<ULong>,
     actual val distances: List<Float>
 ) : Iterable<Match> {
+    actual constructor(keys: ULongArray, distances: FloatArray, size: Int) :
+            this(ULongArrayView(keys, size), FloatArrayView(distances, size))
+
     actual override fun iterator(): Iterator<Match> = iterator {
         for (i in 0 until keys.size) {
             yield(Match(keys[i], distances[i]))
@@ -0,0 +1,17 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+actual class SearchBuffer actual constructor(actual val capacity: Int) {
+    internal val keys = LongArray(capacity)
+    internal val distances = FloatArray(capacity)
+
+    actual var size: Int = 0
+        internal set
+
+    actual fun key(index: Int): ULong = keys[checkIndex(index)].toULong()
+
+    actual fun distance(index: Int): Float = distances[checkIndex(index)]
+
+    actual fun toMatches(): Matches = Matches(keys.copyOf(size).asULongArray(), distances.copyOf(size), size)
+}
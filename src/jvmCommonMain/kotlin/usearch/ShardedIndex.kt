@@ -0,0 +1,78 @@
+@file:OptIn(ExperimentalUnsignedTypes::class)
+
+package usearch
+
+actual class ShardedIndex actual constructor(options: IndexOptions, actual val shards: Int) {
+    init {
+        if (shards <= 0) {
+            throw IllegalArgumentException("At least one shard is required.")
+        }
+    }
+
+    private val dimensions: Int = options.dimensions.toInt()
+
+    private val ptr: Long = options.useNative { opts ->
+        NativeMethods.bridge.usearch_sharded_init(opts, shards.toLong())
+    }
+
+    actual val size: ULong
+        get() = NativeMethods.bridge.usearch_sharded_size(ptr).toULong()
+
+    actual fun add(key: ULong, vec: FloatArray) {
+        if (vec.size != dimensions) {
+            throw IllegalArgumentException("Vector has ${vec.size} scalars instead of $dimensions.")
+        }
+        NativeMethods.bridge.usearch_sharded_add(ptr, key.toLong(), vec)
+    }
+
+    actual fun addAll(keys: ULongArray, matrix: FloatArray) {
+        if (keys.isEmpty()) {
+            return
+        }
+        if (matrix.size != keys.size * dimensions) {
+            throw IllegalArgumentException(
+                "Cannot split ${matrix.size} scalars into ${keys.size} $dimensions-dimensional vectors."
+            )
+        }
+        NativeMethods.bridge.usearch_sharded_add_batch(ptr, keys.asLongArray(), matrix)
+    }
+
+    actual fun remove(key: ULong) {
+        NativeMethods.bridge.usearch_sharded_remove(ptr, key.toLong())
+    }
+
+    actual operator fun contains(key: ULong): Boolean = NativeMethods.bridge.usearch_sharded_contains(ptr, key.toLong())
+
+    actual fun search(query: FloatArray, count: Int): Matches {
+        if (query.size != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        val keys = LongArray(count)
+        val distances = FloatArray(count)
+        val size = NativeMethods.bridge.usearch_sharded_search(ptr, query, count, keys, distances).toInt()
+        return Matches(keys.asULongArray(), distances, size)
+    }
+
+    actual fun saveShard(shard: Int, filePath: String) {
+        NativeMethods.bridge.usearch_save_file(shard(shard), filePath)
+    }
+
+    actual fun loadShard(shard: Int, filePath: String) {
+        NativeMethods.bridge.usearch_load_file(shard(shard), filePath)
+    }
+
+    actual fun viewShard(shard: Int, filePath: String, advice: ViewAdvice) {
+        NativeMethods.bridge.usearch_view_file(shard(shard), filePath, advice.nativeEnum)
+    }
+
+    private fun shard(shard: Int): Long {
+        if (shard !in 0 until shards) {
+            throw IndexOutOfBoundsException("Shard $shard out of range for $shards shards.")
+        }
+        return NativeMethods.bridge.usearch_sharded_shard(ptr, shard.toLong())
+    }
+
+    protected fun finalize() {
+        NativeMethods.bridge.usearch_sharded_free(ptr)
+    }
+}
@@ -0,0 +1,19 @@
+package usearch
+
+import java.io.InputStream
+import java.io.OutputStream
+
+/**
+ * Saves the index to [output] chunk by chunk, in constant memory.
+ * The stream is neither flushed nor closed.
+ * @see Index.saveStream
+ */
+fun Index.saveStream(output: OutputStream, bufferSize: Int = Index.STREAM_BUFFER_SIZE) =
+    saveStream(bufferSize) { buffer, length -> output.write(buffer, 0, length) }
+
+/**
+ * Loads the index from [input] chunk by chunk, leaving whatever follows the index unread.
+ * @see Index.loadStream
+ */
+fun Index.loadStream(input: InputStream, bufferSize: Int = Index.STREAM_BUFFER_SIZE) =
+    loadStream(bufferSize) { buffer, length -> input.read(buffer, 0, length) }
@@ -0,0 +1,27 @@
+package usearch
+
+actual class VectorStore private constructor(
+    internal val ptr: Long,
+    internal val kind: ScalarKind,
+    internal val fetch: VectorFetch?
+) {
+    protected fun finalize() {
+        if (ptr != 0L) {
+            NativeMethods.bridge.usearch_store_free(ptr)
+        }
+    }
+
+    actual companion object {
+        actual fun mapFile(filePath: String, dimensions: ULong, kind: ScalarKind): VectorStore {
+            if (kind != ScalarKind.F32 && kind != ScalarKind.F64) {
+                throw IllegalArgumentException("Full-precision vectors must be F32 or F64, not $kind.")
+            }
+            return VectorStore(
+                NativeMethods.bridge.usearch_store_map_file(filePath, kind.nativeEnum, dimensions.toLong()), kind, null
+            )
+        }
+
+        actual fun fetching(fetch: (key: ULong, vector: FloatArray) -> Boolean): VectorStore =
+            VectorStore(0L, ScalarKind.F32, VectorFetch { key, vector -> fetch(key.toULong(), vector) })
+    }
+}
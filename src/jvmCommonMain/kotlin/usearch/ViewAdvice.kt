@@ -0,0 +1,5 @@
+package usearch
+
+actual enum class ViewAdvice(val nativeEnum: Int) {
+    Normal(0), Random(1), Sequential(2), WillNeed(3)
+}
@@ -0,0 +1,61 @@
+import usearch.Index
+import usearch.IndexOptions
+import usearch.MetricKind
+import usearch.ScalarKind
+import usearch.add
+import usearch.distanceMatrix
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.FloatBuffer
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class DirectBufferTest {
+    private fun directFloats(vararg values: Float) =
+        ByteBuffer.allocateDirect(values.size * Float.SIZE_BYTES)
+            .order(ByteOrder.nativeOrder())
+            .asFloatBuffer()
+            .put(values)
+            .apply { flip() }
+
+    @Test
+    fun addAndSearch() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32))
+        index.asF32.add(1u, directFloats(1f, 2f, 3f))
+        index.asF32.add(2u, directFloats(-3f, 1f, -2f))
+        assertContentEquals(floatArrayOf(1f, 2f, 3f), index.asF32[1u])
+
+        val query = directFloats(0f, -3f, 1f, -2f)
+        query.position(1)
+        assertEquals(listOf(2uL), index.search(query, 1).keys)
+    }
+
+    @Test
+    fun distances() {
+        val matrix = directFloats(1f, 2f, 3f, -3f, 1f, -2f)
+        assertContentEquals(
+            floatArrayOf(0f, 50f),
+            distanceMatrix(directFloats(1f, 2f, 3f), matrix, 3u, ScalarKind.F32, MetricKind.L2sq)
+        )
+        assertContentEquals(
+            floatArrayOf(0f, 50f, 50f, 0f),
+            distanceMatrix(matrix.duplicate(), matrix, 3u, ScalarKind.F32, MetricKind.L2sq)
+        )
+        assertFailsWith(IllegalArgumentException::class) {
+            distanceMatrix(directFloats(1f, 2f), matrix, 3u, ScalarKind.F32, MetricKind.L2sq)
+        }
+    }
+
+    @Test
+    fun rejectsUnsuitableBuffers() {
+        val index = Index(IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32))
+        assertFailsWith(IllegalArgumentException::class) {
+            index.asF32.add(1u, FloatBuffer.wrap(floatArrayOf(1f, 2f, 3f)))
+        }
+        assertFailsWith(IllegalArgumentException::class) {
+            index.search(directFloats(1f, 2f), 1)
+        }
+    }
+}
@@ -0,0 +1,31 @@
+import usearch.IndexOptions
+import usearch.MetricKind
+import usearch.ScalarKind
+import usearch.ShardedIndex
+import java.io.File
+import kotlin.test.Test
+import kotlin.test.assertEquals
+
+class ShardedIndexTest {
+    @Test
+    fun swapShard() {
+        val options = IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32, threadSafe = true)
+        val index = ShardedIndex(options, 3)
+        repeat(300) {
+            index.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+        }
+        val file = File.createTempFile("usearch-shard", ".bin")
+        try {
+            val rebuilt = ShardedIndex(options, 3)
+            repeat(3) { shard ->
+                index.saveShard(shard, file.path)
+                if (shard == 1) rebuilt.viewShard(shard, file.path) else rebuilt.loadShard(shard, file.path)
+            }
+            assertEquals(index.size, rebuilt.size)
+            val query = floatArrayOf(42f, 0f, 0f)
+            assertEquals(index.search(query, 5).keys, rebuilt.search(query, 5).keys)
+        } finally {
+            file.delete()
+        }
+    }
+}
@@ -0,0 +1,40 @@
+import usearch.Index
+import usearch.IndexOptions
+import usearch.MetricKind
+import usearch.ScalarKind
+import usearch.USearchException
+import usearch.VectorStore
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class VectorStoreTest {
+    @Test
+    fun mapFile() {
+        val index = Index(IndexOptions(2u, MetricKind.L2sq, ScalarKind.F16))
+        val matrix = ByteBuffer.allocate(100 * 2 * Double.SIZE_BYTES).order(ByteOrder.nativeOrder())
+        repeat(100) {
+            val vector = doubleArrayOf(it / 10.0, 1.0 / (it + 1))
+            index.asF64.add(it.toULong(), vector)
+            matrix.putDouble(vector[0]).putDouble(vector[1])
+        }
+        val file = File.createTempFile("usearch", ".f64")
+        try {
+            file.writeBytes(matrix.array())
+            val store = VectorStore.mapFile(file.path, 2u, ScalarKind.F64)
+            val matches = index.searchReranked(floatArrayOf(4.2f, 1f / 43), 3, store)
+            assertEquals(setOf(41uL, 42uL, 43uL), matches.keys.toSet())
+            assertEquals(42uL, matches.keys.first())
+
+            file.appendBytes(ByteArray(3))
+            assertFailsWith(USearchException::class) {
+                VectorStore.mapFile(file.path, 2u, ScalarKind.F64)
+            }
+        } finally {
+            file.delete()
+        }
+    }
+}
@@ -0,0 +1,58 @@
+import usearch.Index
+import usearch.IndexOptions
+import usearch.MetricKind
+import usearch.ScalarKind
+import usearch.USearchException
+import usearch.ViewAdvice
+import java.io.File
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+class ViewFileTest {
+    @Test
+    fun viewFile() {
+        val options = IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32)
+        val index = Index(options)
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+        }
+        val file = File.createTempFile("usearch", ".bin")
+        try {
+            index.saveFile(file.path)
+            ViewAdvice.entries.forEach { advice ->
+                val view = Index(options)
+                view.viewFile(file.path, advice)
+                assertEquals(index.size, view.size)
+                assertEquals(listOf(42uL), view.search(floatArrayOf(42f, 0f, 0f), 1).keys)
+            }
+        } finally {
+            file.delete()
+        }
+    }
+
+    @Test
+    fun loadHugePages() {
+        val options = IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32)
+        val index = Index(options)
+        repeat(100) {
+            index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+        }
+        val file = File.createTempFile("usearch", ".bin")
+        try {
+            index.saveFile(file.path)
+            val loaded = Index(options)
+            loaded.loadHugePages(file.path)
+            assertEquals(index.size, loaded.size)
+            assertEquals(listOf(42uL), loaded.search(floatArrayOf(42f, 0f, 0f), 1).keys)
+            val breakdown = loaded.memoryBreakdown
+            assertTrue(breakdown.hugePages >= file.length().toULong())
+            assertEquals(0uL, breakdown.hugePages % (2uL shl 20))
+            assertEquals(loaded.memoryUsage, breakdown.total)
+            assertFailsWith<USearchException> { loaded.asF32.add(100u, floatArrayOf(0f, 1f, 0f)) }
+        } finally {
+            file.delete()
+        }
+    }
+}
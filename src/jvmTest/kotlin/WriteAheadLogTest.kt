@@ -0,0 +1,82 @@
+import usearch.Index
+import usearch.IndexOptions
+import usearch.MetricKind
+import usearch.ScalarKind
+import usearch.USearchException
+import java.io.File
+import kotlin.io.path.createTempDirectory
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.milliseconds
+
+class WriteAheadLogTest {
+    private val options = IndexOptions(3u, MetricKind.L2sq, ScalarKind.F32)
+
+    @Test
+    fun replayAndCheckpoint() {
+        val dir = createTempDirectory("usearch").toFile()
+        val log = File(dir, "index.wal").path
+        val snapshot = File(dir, "index.bin").path
+        try {
+            val index = Index(options)
+            assertEquals(0u, index.openLog(log, syncEvery = 1u))
+            repeat(10) {
+                index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+            }
+            index.remove(3u)
+            index.closeLog()
+
+            // A crash in the middle of a record leaves a torn tail, which is dropped on replay.
+            File(log).appendBytes(byteArrayOf(1, 7, 0))
+            val recovered = Index(options)
+            assertEquals(11u, recovered.openLog(log))
+            assertEquals(9u, recovered.size)
+            assertTrue(3uL !in recovered)
+            assertEquals(listOf(7uL), recovered.search(floatArrayOf(7f, 0f, 0f), 1).keys)
+
+            recovered.asF32.add(42u, floatArrayOf(42f, 0f, 0f))
+            recovered.checkpoint(snapshot)
+            recovered.asF32.add(43u, floatArrayOf(43f, 0f, 0f))
+            recovered.closeLog()
+
+            val restarted = Index(options)
+            restarted.loadFile(snapshot)
+            assertEquals(1u, restarted.openLog(log))
+            assertEquals(11u, restarted.size)
+            assertFailsWith(USearchException::class) {
+                restarted.checkpointEvery(snapshot, 10.milliseconds)
+            }
+        } finally {
+            dir.deleteRecursively()
+        }
+    }
+
+    @Test
+    fun backgroundCheckpoints() {
+        val dir = createTempDirectory("usearch").toFile()
+        val log = File(dir, "index.wal").path
+        val snapshot = File(dir, "index.bin")
+        try {
+            val index = Index(options.copy(threadSafe = true))
+            index.openLog(log)
+            index.checkpointEvery(snapshot.path, 10.milliseconds, minRecords = 5u)
+            repeat(5) {
+                index.asF32.add(it.toULong(), floatArrayOf(it.toFloat(), 0f, 0f))
+            }
+            repeat(100) {
+                if (!snapshot.exists()) Thread.sleep(10)
+            }
+            index.checkpointEvery(snapshot.path, Duration.ZERO)
+            index.syncLog()
+
+            val restored = Index(options)
+            restored.loadFile(snapshot.path)
+            assertEquals(5u, restored.size)
+        } finally {
+            dir.deleteRecursively()
+        }
+    }
+}
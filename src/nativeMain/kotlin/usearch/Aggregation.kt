@@ -0,0 +1,9 @@
+package usearch
+
+import kotlinx.cinterop.ExperimentalForeignApi
+import lib.*
+
+@OptIn(ExperimentalForeignApi::class)
+actual enum class Aggregation(val nativeEnum: UInt) {
+    Min(usearch_aggregation_min_k), Mean(usearch_aggregation_mean_k), TopSum(usearch_aggregation_top_sum_k)
+}
@@ -0,0 +1,108 @@
+@file:OptIn(ExperimentalForeignApi::class)
+
+package usearch
+
+import kotlinx.cinterop.*
+import lib.*
+
+actual fun distances(query: FloatArray, matrix: FloatArray, metric: MetricKind, threads: ULong): FloatArray {
+    val rows = checkMatrix(matrix, query.size, "matrix")
+    val distances = FloatArray(rows)
+    if (rows == 0) {
+        return distances
+    }
+    errorScoped {
+        query.usePinned { q ->
+            matrix.usePinned { m ->
+                distances.usePinned { d ->
+                    usearch_distances(
+                        q.addressOf(0), m.addressOf(0), rows.toULong(), (query.size * Float.SIZE_BYTES).toULong(),
+                        usearch_scalar_f32_k, query.size.toULong(), metric.nativeEnum, threads,
+                        d.addressOf(0), err
+                    )
+                }
+            }
+        }
+    }
+    return distances
+}
+
+actual fun distanceMatrix(
+    queries: FloatArray,
+    matrix: FloatArray,
+    dimensions: ULong,
+    metric: MetricKind,
+    threads: ULong
+): FloatArray {
+    val queriesRows = checkMatrix(queries, dimensions.toInt(), "queries")
+    val rows = checkMatrix(matrix, dimensions.toInt(), "matrix")
+    val distances = FloatArray(queriesRows * rows)
+    if (distances.isEmpty()) {
+        return distances
+    }
+    queries.usePinned { q ->
+        matrix.usePinned { m ->
+            distances.usePinned { d ->
+                distanceMatrixInto(
+                    q.addressOf(0), queriesRows, m.addressOf(0), rows, dimensions, ScalarKind.F32, metric, threads,
+                    d.addressOf(0)
+                )
+            }
+        }
+    }
+    return distances
+}
+
+/**
+ * Same as [distanceMatrix], but reads the vectors straight from native memory, rows packed back to back.
+ * A single query gives one distance per row of [matrix].
+ * @param kind how the scalars behind both pointers are interpreted.
+ */
+fun distanceMatrix(
+    queries: CPointer<*>,
+    queriesCount: Int,
+    matrix: CPointer<*>,
+    count: Int,
+    dimensions: ULong,
+    kind: ScalarKind,
+    metric: MetricKind,
+    threads: ULong = 0u
+): FloatArray {
+    val distances = FloatArray(queriesCount * count)
+    if (distances.isEmpty()) {
+        return distances
+    }
+    distances.usePinned { d ->
+        distanceMatrixInto(queries, queriesCount, matrix, count, dimensions, kind, metric, threads, d.addressOf(0))
+    }
+    return distances
+}
+
+/** Writes the distances of [distanceMatrix] to [distances], which must have room for `queriesCount * count`. */
+private fun distanceMatrixInto(
+    queries: CPointer<*>,
+    queriesCount: Int,
+    matrix: CPointer<*>,
+    count: Int,
+    dimensions: ULong,
+    kind: ScalarKind,
+    metric: MetricKind,
+    threads: ULong,
+    distances: CPointer<FloatVar>
+) {
+    val stride = if (kind == ScalarKind.B1) (dimensions + 7u) / 8u else dimensions * kind.bytes.toULong()
+    errorScoped {
+        if (queriesCount == 1) {
+            usearch_distances(
+                queries, matrix, count.toULong(), stride, kind.nativeEnum, dimensions, metric.nativeEnum, threads,
+                distances, err
+            )
+        } else {
+            usearch_distances_matrix(
+                queries, queriesCount.toULong(), stride, matrix, count.toULong(), stride,
+                kind.nativeEnum, dimensions, metric.nativeEnum, threads,
+                distances, (count * Float.SIZE_BYTES).toULong(), err
+            )
+        }
+    }
+}
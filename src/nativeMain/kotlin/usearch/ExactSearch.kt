@@ -0,0 +1,43 @@
+@file:OptIn(ExperimentalForeignApi::class, ExperimentalUnsignedTypes::class)
+
+package usearch
+
+import kotlinx.cinterop.*
+import lib.*
+
+actual fun exactSearch(
+    dataset: FloatArray,
+    queries: FloatArray,
+    dimensions: ULong,
+    count: Int,
+    metric: MetricKind,
+    threads: ULong
+): List<Matches> {
+    val datasetRows = checkMatrix(dataset, dimensions.toInt(), "dataset")
+    val queriesRows = checkMatrix(queries, dimensions.toInt(), "queries")
+    if (datasetRows == 0 || queriesRows == 0) {
+        return List(queriesRows) { Matches(emptyList(), emptyList()) }
+    }
+    val found = minOf(count, datasetRows)
+    return errorScoped {
+        val keys = allocArray<usearch_key_tVar>(queriesRows * count)
+        val distances = allocArray<FloatVar>(queriesRows * count)
+        dataset.usePinned { d ->
+            queries.usePinned { q ->
+                usearch_exact_search(
+                    d.addressOf(0), datasetRows.toULong(), dimensions * Float.SIZE_BYTES.toULong(),
+                    q.addressOf(0), queriesRows.toULong(), dimensions * Float.SIZE_BYTES.toULong(),
+                    usearch_scalar_f32_k, dimensions,
+                    metric.nativeEnum, count.toULong(), threads,
+                    keys, (count * Long.SIZE_BYTES).toULong(),
+                    distances, (count * Float.SIZE_BYTES).toULong(),
+                    err
+                )
+            }
+        }
+        List(queriesRows) { row ->
+            val offset = row * count
+            Matches(ULongArray(found) { keys[offset + it] }, FloatArray(found) { distances[offset + it] }, found)
+        }
+    }
+}
@@ -5,11 +5,14 @@ import lib.*
 import kotlin.experimental.ExperimentalNativeApi
 import kotlin.native.ref.Cleaner
 import kotlin.native.ref.createCleaner
+import kotlin.time.Duration
 
-@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class)
+@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class, ExperimentalUnsignedTypes::class)
 actual class Index {
     private val inner: StableRef<CPointed>
     private var _metricKind: MetricKind
+    private var _statsEnabled = false
+    private var _cacheCapacity = 0uL
 
     private val cleaner: Cleaner
 
@@ -24,6 +27,9 @@ actual class Index {
             // somehow the C implementation doesn't reserve at init time
             usearch_reserve(inner.asCPointer(), INITIAL_CAPACITY.toULong(), err)
         }
+        errorScoped {
+            usearch_change_growth_policy(inner.asCPointer(), GROWTH_FACTOR, INCREMENTAL_CAPACITY.toULong(), err)
+        }
 
         cleaner = createCleaner(inner) {
             try {
@@ -90,6 +96,64 @@ actual class Index {
             usearch_memory_usage(inner.asCPointer(), err)
         }
 
+    actual val memoryBreakdown: MemoryBreakdown
+        get() = errorScoped {
+            val breakdown = alloc<usearch_memory_breakdown_t>()
+            usearch_memory_breakdown(inner.asCPointer(), breakdown.ptr, err)
+            MemoryBreakdown(
+                breakdown.graph, breakdown.vectors, breakdown.lookup,
+                breakdown.huge_pages, breakdown.other, breakdown.total
+            )
+        }
+
+    actual val tombstones: ULong
+        get() = errorScoped {
+            usearch_tombstones(inner.asCPointer(), err)
+        }
+
+    actual var statsEnabled: Boolean
+        get() = _statsEnabled
+        set(value) {
+            errorScoped {
+                usearch_enable_stats(inner.asCPointer(), value, err)
+            }
+            _statsEnabled = value
+        }
+
+    actual val stats: IndexStats
+        get() = errorScoped {
+            val stats = alloc<usearch_stats_t>()
+            usearch_stats(inner.asCPointer(), stats.ptr, err)
+            val buckets = LatencyHistogram.BUCKETS
+            indexStatsOf(ULongArray(INDEX_STATS_LENGTH) {
+                when {
+                    it == 0 -> stats.searches
+                    it == 1 -> stats.hops
+                    it == 2 -> stats.distances
+                    it == 3 -> stats.filtered
+                    it == 4 -> stats.adds
+                    it < 5 + buckets -> stats.search_latency[it - 5]
+                    else -> stats.add_latency[it - 5 - buckets]
+                }
+            })
+        }
+
+    actual var cacheCapacity: ULong
+        get() = _cacheCapacity
+        set(value) {
+            errorScoped {
+                usearch_enable_cache(inner.asCPointer(), value, err)
+            }
+            _cacheCapacity = value
+        }
+
+    actual val cacheStats: CacheStats
+        get() = errorScoped {
+            val stats = alloc<usearch_cache_stats_t>()
+            usearch_cache_stats(inner.asCPointer(), stats.ptr, err)
+            CacheStats(stats.hits, stats.misses, stats.entries)
+        }
+
     actual val serializedLength: ULong
         get() = errorScoped {
             usearch_serialized_length(inner.asCPointer(), err)
@@ -101,12 +165,30 @@ actual class Index {
         }
     }
 
+    actual fun compact(threads: ULong) {
+        errorScoped {
+            usearch_compact(inner.asCPointer(), threads, err)
+        }
+    }
+
+    actual fun resetStats() {
+        errorScoped {
+            usearch_reset_stats(inner.asCPointer(), err)
+        }
+    }
+
     actual fun reserve(capacity: ULong) {
         errorScoped {
             usearch_reserve(inner.asCPointer(), capacity, err)
         }
     }
 
+    actual fun changeGrowthPolicy(factor: Float, minStep: ULong) {
+        errorScoped {
+            usearch_change_growth_policy(inner.asCPointer(), factor, minStep, err)
+        }
+    }
+
     actual val asF32: IndexQuery<FloatArray> by lazy(::F32Q)
     actual val asF64: IndexQuery<DoubleArray> by lazy(::F64Q)
     actual val asF16: IndexQuery<Float16Array> by lazy(::F16Q)
@@ -128,7 +210,169 @@ actual class Index {
                     err
                 )
             }.toInt()
-            Matches(List(size) { keys[it] }, List(size) { distances[it] })
+            Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+        }
+    }
+
+    actual fun search(query: FloatArray, count: Int, filter: KeyFilter): Matches = asF32.search(query, count, filter)
+
+    actual fun search(query: FloatArray, buffer: SearchBuffer): Int = asF32.search(query, buffer)
+
+    actual fun searchReranked(query: FloatArray, count: Int, store: VectorStore, oversample: Int): Matches {
+        if (oversample < 1) {
+            throw IllegalArgumentException("Oversample $oversample is less than 1.")
+        }
+        if (query.size.toULong() != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        return store.use(query.size) { storePtr ->
+            errorScoped {
+                val keys = allocArray<usearch_key_tVar>(count)
+                val distances = allocArray<FloatVar>(count)
+                val search = { vector: COpaquePointer ->
+                    usearch_search_rerank(
+                        inner.asCPointer(),
+                        vector,
+                        store.kind.nativeEnum,
+                        count.toULong(),
+                        oversample.toULong(),
+                        storePtr,
+                        keys,
+                        distances,
+                        err
+                    )
+                }
+                val size = if (store.kind == ScalarKind.F64) {
+                    DoubleArray(query.size) { query[it].toDouble() }.usePinned { search(it.addressOf(0)) }
+                } else {
+                    query.usePinned { search(it.addressOf(0)) }
+                }.toInt()
+                Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+            }
+        }
+    }
+
+    actual fun searchBatch(queries: FloatArray, count: Int, threads: ULong): List<Matches> {
+        val dimensions = dimensions.toInt()
+        if (dimensions <= 0 || queries.size % dimensions != 0) {
+            throw IllegalArgumentException("Cannot split ${queries.size} scalars into $dimensions-dimensional queries.")
+        }
+        val rows = queries.size / dimensions
+        if (rows == 0) {
+            return emptyList()
+        }
+        return errorScoped {
+            val keys = allocArray<usearch_key_tVar>(rows * count)
+            val distances = allocArray<FloatVar>(rows * count)
+            val counts = allocArray<ULongVar>(rows)
+            queries.usePinned {
+                usearch_search_batch(
+                    inner.asCPointer(),
+                    it.addressOf(0),
+                    usearch_scalar_f32_k,
+                    rows.toULong(),
+                    (dimensions * Float.SIZE_BYTES).toULong(),
+                    count.toULong(),
+                    threads,
+                    keys,
+                    (count * Long.SIZE_BYTES).toULong(),
+                    distances,
+                    (count * Float.SIZE_BYTES).toULong(),
+                    counts,
+                    err
+                )
+            }
+            List(rows) { row ->
+                val offset = row * count
+                val size = counts[row].toInt()
+                Matches(ULongArray(size) { keys[offset + it] }, FloatArray(size) { distances[offset + it] }, size)
+            }
+        }
+    }
+
+    actual fun searchWithin(query: FloatArray, radius: Float, maxResults: Int): Matches {
+        if (query.size.toULong() != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        return errorScoped {
+            val keys = allocArray<usearch_key_tVar>(maxResults)
+            val distances = allocArray<FloatVar>(maxResults)
+            val size = query.usePinned {
+                usearch_range_search(
+                    inner.asCPointer(),
+                    it.addressOf(0),
+                    usearch_scalar_f32_k,
+                    radius,
+                    maxResults.toULong(),
+                    keys,
+                    distances,
+                    err
+                )
+            }.toInt()
+            Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+        }
+    }
+
+    actual fun searchGrouped(query: FloatArray, count: Int, aggregation: Aggregation, topM: Int): Matches {
+        if (query.size.toULong() != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        return errorScoped {
+            val keys = allocArray<usearch_key_tVar>(count)
+            val distances = allocArray<FloatVar>(count)
+            val size = query.usePinned {
+                usearch_search_grouped(
+                    inner.asCPointer(),
+                    it.addressOf(0),
+                    usearch_scalar_f32_k,
+                    count.toULong(),
+                    aggregation.nativeEnum,
+                    topM.toULong(),
+                    keys,
+                    distances,
+                    err
+                )
+            }.toInt()
+            Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+        }
+    }
+
+    actual fun searchWithinBatch(queries: FloatArray, radius: Float, maxResults: Int, threads: ULong): List<Matches> {
+        val dimensions = dimensions.toInt()
+        if (dimensions <= 0 || queries.size % dimensions != 0) {
+            throw IllegalArgumentException("Cannot split ${queries.size} scalars into $dimensions-dimensional queries.")
+        }
+        val rows = queries.size / dimensions
+        if (rows == 0) {
+            return emptyList()
+        }
+        return errorScoped {
+            val keys = allocArray<usearch_key_tVar>(rows * maxResults)
+            val distances = allocArray<FloatVar>(rows * maxResults)
+            val counts = allocArray<ULongVar>(rows)
+            queries.usePinned {
+                usearch_range_search_batch(
+                    inner.asCPointer(),
+                    it.addressOf(0),
+                    usearch_scalar_f32_k,
+                    rows.toULong(),
+                    (dimensions * Float.SIZE_BYTES).toULong(),
+                    radius,
+                    maxResults.toULong(),
+                    threads,
+                    keys,
+                    (maxResults * Long.SIZE_BYTES).toULong(),
+                    distances,
+                    (maxResults * Float.SIZE_BYTES).toULong(),
+                    counts,
+                    err
+                )
+            }
+            List(rows) { row ->
+                val offset = row * maxResults
+                val size = counts[row].toInt()
+                Matches(ULongArray(size) { keys[offset + it] }, FloatArray(size) { distances[offset + it] }, size)
+            }
         }
     }
 
@@ -143,6 +387,18 @@ actual class Index {
         }
     }
 
+    actual fun viewFile(filePath: String, advice: ViewAdvice) {
+        errorScoped {
+            usearch_view_file(inner.asCPointer(), filePath, advice.nativeEnum, err)
+        }
+    }
+
+    actual fun loadHugePages(filePath: String) {
+        errorScoped {
+            usearch_load_huge_pages(inner.asCPointer(), filePath, err)
+        }
+    }
+
     actual fun loadBuffer(buffer: ByteArray) {
         if (buffer.isEmpty()) {
             throw IllegalArgumentException("Cannot load empty buffer.")
@@ -165,6 +421,25 @@ actual class Index {
         }
     }
 
+    actual fun saveStream(bufferSize: Int, write: (buffer: ByteArray, length: Int) -> Unit) {
+        StreamState(bufferSize) { buffer, length ->
+            write(buffer, length)
+            length
+        }.use { state ->
+            errorScoped {
+                usearch_save_stream(inner.asCPointer(), streamWrite, state, err)
+            }
+        }
+    }
+
+    actual fun loadStream(bufferSize: Int, read: (buffer: ByteArray, length: Int) -> Int) {
+        StreamState(bufferSize, read).use { state ->
+            errorScoped {
+                usearch_load_stream(inner.asCPointer(), streamRead, state, err)
+            }
+        }
+    }
+
     actual fun saveBuffer(buffer: ByteArray) {
         if (buffer.isEmpty()) {
             throw IllegalArgumentException("Cannot save to empty buffer.")
@@ -181,19 +456,100 @@ actual class Index {
         }
     }
 
+    actual fun openLog(filePath: String, syncEvery: ULong): ULong = errorScoped {
+        usearch_wal_open(inner.asCPointer(), filePath, syncEvery, err)
+    }
+
+    actual fun syncLog() {
+        errorScoped {
+            usearch_wal_sync(inner.asCPointer(), err)
+        }
+    }
+
+    actual fun closeLog() {
+        errorScoped {
+            usearch_wal_close(inner.asCPointer(), err)
+        }
+    }
+
+    actual fun checkpoint(filePath: String) {
+        errorScoped {
+            usearch_checkpoint(inner.asCPointer(), filePath, err)
+        }
+    }
+
+    actual fun checkpointEvery(filePath: String, interval: Duration, minRecords: ULong) {
+        errorScoped {
+            usearch_checkpoint_every(
+                inner.asCPointer(), filePath, interval.inWholeMilliseconds.toULong(), minRecords, err
+            )
+        }
+    }
+
+    internal actual fun startQueue(depth: Int, batchSize: Int, threads: ULong) {
+        errorScoped {
+            usearch_queue_init(inner.asCPointer(), depth.toULong(), batchSize.toULong(), threads, err)
+        }
+    }
+
+    internal actual fun stopQueue() {
+        errorScoped {
+            usearch_queue_free(inner.asCPointer(), err)
+        }
+    }
+
+    internal actual fun submitSearch(query: FloatArray, count: Int, done: (Result<Matches>) -> Unit): Boolean {
+        val ref = StableRef.create(done)
+        val accepted = try {
+            errorScoped {
+                query.usePinned {
+                    usearch_submit_search(
+                        inner.asCPointer(), it.addressOf(0), usearch_scalar_f32_k, count.toULong(),
+                        queueSearched, ref.asCPointer(), err
+                    )
+                }
+            }
+        } catch (e: USearchException) {
+            ref.dispose()
+            throw e
+        }
+        if (!accepted) {
+            ref.dispose()
+        }
+        return accepted
+    }
+
+    internal actual fun submitAdd(key: ULong, vector: FloatArray, done: (Result<Unit>) -> Unit): Boolean {
+        val ref = StableRef.create(done)
+        val accepted = try {
+            errorScoped {
+                vector.usePinned {
+                    usearch_submit_add(
+                        inner.asCPointer(), key, it.addressOf(0), usearch_scalar_f32_k,
+                        queueAdded, ref.asCPointer(), err
+                    )
+                }
+            }
+        } catch (e: USearchException) {
+            ref.dispose()
+            throw e
+        }
+        if (!accepted) {
+            ref.dispose()
+        }
+        return accepted
+    }
+
     abstract inner class CommonIndexQuery<T : Any>(val vectorKind: ScalarKind) : IndexQuery<T> {
         abstract fun constructDefaultArray(size: Int): T
         abstract fun Pinned<T>.addr(index: Int): CPointer<*>
         abstract fun T.slice(indices: IntRange): T
-        abstract fun isEmpty(vec: T): Boolean
+        abstract fun sizeOf(vec: T): Int
 
         override fun add(key: ULong, vec: T) {
-            if (isEmpty(vec)) {
+            if (sizeOf(vec) <= 0) {
                 throw IllegalArgumentException("Cannot add empty vector.")
             }
-            if (capacity < size + 1u) {
-                reserve(INCREMENTAL_CAPACITY.toULong())
-            }
             errorScoped {
                 vec.usePinned {
                     usearch_add(inner.asCPointer(), key, it.addr(0), vectorKind.nativeEnum, err)
@@ -201,6 +557,89 @@ actual class Index {
             }
         }
 
+        override fun addAll(keys: ULongArray, matrix: T, threads: ULong) {
+            if (keys.isEmpty()) {
+                return
+            }
+            val dimensions = dimensions.toInt()
+            val rowScalars = if (vectorKind == ScalarKind.B1) (dimensions + 7) / 8 else dimensions
+            val scalars = sizeOf(matrix)
+            if (scalars != keys.size * rowScalars) {
+                throw IllegalArgumentException(
+                    "Cannot split $scalars scalars into ${keys.size} $dimensions-dimensional vectors."
+                )
+            }
+            errorScoped {
+                keys.usePinned { k ->
+                    matrix.usePinned {
+                        usearch_add_batch(
+                            inner.asCPointer(),
+                            k.addressOf(0),
+                            it.addr(0),
+                            keys.size.toULong(),
+                            (rowScalars * vectorKind.bytes).toULong(),
+                            vectorKind.nativeEnum,
+                            threads,
+                            err
+                        )
+                    }
+                }
+            }
+        }
+
+        override fun search(query: T, count: Int): Matches = errorScoped {
+            val keys = allocArray<usearch_key_tVar>(count)
+            val distances = allocArray<FloatVar>(count)
+            val size = query.usePinned {
+                usearch_search(
+                    inner.asCPointer(),
+                    it.addr(0),
+                    vectorKind.nativeEnum,
+                    count.toULong(),
+                    keys,
+                    distances,
+                    err
+                )
+            }.toInt()
+            Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+        }
+
+        override fun search(query: T, count: Int, filter: KeyFilter): Matches = errorScoped {
+            val keys = allocArray<usearch_key_tVar>(count)
+            val distances = allocArray<FloatVar>(count)
+            val size = query.usePinned {
+                usearch_search_filter(
+                    inner.asCPointer(),
+                    it.addr(0),
+                    vectorKind.nativeEnum,
+                    count.toULong(),
+                    filter.ptr,
+                    keys,
+                    distances,
+                    err
+                )
+            }.toInt()
+            Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+        }
+
+        override fun search(query: T, buffer: SearchBuffer): Int {
+            buffer.size = 0
+            val size = query.usePinned {
+                usearch_search(
+                    inner.asCPointer(),
+                    it.addr(0),
+                    vectorKind.nativeEnum,
+                    buffer.capacity.toULong(),
+                    buffer.keys,
+                    buffer.distances,
+                    buffer.error.ptr
+                )
+            }.toInt()
+            buffer.rethrow()
+            buffer.size = size
+            return size
+        }
+
         override fun get(key: ULong): T? = errorScoped {
             constructDefaultArray(dimensions.toInt()).apply {
                 usePinned {
@@ -216,7 +655,7 @@ actual class Index {
             val dimensions = dimensions.toInt()
             constructDefaultArray(dimensions * count.toInt()).apply {
                 usePinned {
-                    usearch_get(inner.asCPointer(), key, count, it.addr(0), usearch_scalar_f32_k, err)
+                    usearch_get(inner.asCPointer(), key, count, it.addr(0), vectorKind.nativeEnum, err)
                 }
             }.let {
                 (0 until count.toInt()).map { part ->
@@ -224,10 +663,36 @@ actual class Index {
                 }
             }
         }
+
+        override fun getAll(keys: ULongArray, threads: ULong): T {
+            val dimensions = dimensions.toInt()
+            val rowBytes = if (vectorKind == ScalarKind.B1) (dimensions + 7) / 8 else dimensions * vectorKind.bytes
+            val matrix = constructDefaultArray(keys.size * rowBytes / vectorKind.bytes)
+            if (keys.isEmpty()) {
+                return matrix
+            }
+            errorScoped {
+                keys.usePinned { k ->
+                    matrix.usePinned {
+                        usearch_get_batch(
+                            inner.asCPointer(),
+                            k.addressOf(0),
+                            keys.size.toULong(),
+                            it.addr(0),
+                            rowBytes.toULong(),
+                            vectorKind.nativeEnum,
+                            threads,
+                            err
+                        )
+                    }
+                }
+            }
+            return matrix
+        }
     }
 
     inner class F32Q : CommonIndexQuery<FloatArray>(ScalarKind.F32) {
-        override fun isEmpty(vec: FloatArray): Boolean = vec.isEmpty()
+        override fun sizeOf(vec: FloatArray): Int = vec.size
 
         override fun constructDefaultArray(size: Int): FloatArray = FloatArray(size)
 
@@ -237,7 +702,7 @@ actual class Index {
     }
 
     inner class F64Q : CommonIndexQuery<DoubleArray>(ScalarKind.F64) {
-        override fun isEmpty(vec: DoubleArray): Boolean = vec.isEmpty()
+        override fun sizeOf(vec: DoubleArray): Int = vec.size
 
         override fun constructDefaultArray(size: Int): DoubleArray = DoubleArray(size)
 
@@ -247,7 +712,7 @@ actual class Index {
     }
 
     inner class F16Q : CommonIndexQuery<Float16Array>(ScalarKind.F16) {
-        override fun isEmpty(vec: Float16Array): Boolean = vec.isEmpty()
+        override fun sizeOf(vec: Float16Array): Int = vec.size
 
         override fun constructDefaultArray(size: Int): Float16Array = Float16Array(size)
 
@@ -257,7 +722,7 @@ actual class Index {
     }
 
     inner class I8Q : CommonIndexQuery<ByteArray>(ScalarKind.I8) {
-        override fun isEmpty(vec: ByteArray): Boolean = vec.isEmpty()
+        override fun sizeOf(vec: ByteArray): Int = vec.size
 
         override fun constructDefaultArray(size: Int): ByteArray = ByteArray(size)
 
@@ -267,7 +732,7 @@ actual class Index {
     }
 
     inner class B1Q : CommonIndexQuery<ByteArray>(ScalarKind.B1) {
-        override fun isEmpty(vec: ByteArray): Boolean = vec.isEmpty()
+        override fun sizeOf(vec: ByteArray): Int = vec.size
 
         override fun constructDefaultArray(size: Int): ByteArray = ByteArray(size)
 
@@ -279,5 +744,28 @@ actual class Index {
     actual companion object {
         actual val INITIAL_CAPACITY: Long = 5L
         actual val INCREMENTAL_CAPACITY: Long = 5L
+        actual val GROWTH_FACTOR: Float = 2f
+        actual val STREAM_BUFFER_SIZE: Int = 64 * 1024
     }
-}
\ No newline at end of file
+}
+@OptIn(ExperimentalForeignApi::class, ExperimentalUnsignedTypes::class)
+internal val queueSearched = staticCFunction {
+        keys: CPointer<usearch_key_tVar>?, distances: CPointer<FloatVar>?, found: ULong,
+        error: CPointer<ByteVar>?, state: COpaquePointer? ->
+    val ref = state!!.asStableRef<(Result<Matches>) -> Unit>()
+    val done = ref.get()
+    ref.dispose()
+    val size = found.toInt()
+    done(
+        if (error == null) Result.success(Matches(ULongArray(size) { keys!![it] }, FloatArray(size) { distances!![it] }, size))
+        else Result.failure(USearchException(error.toKString()))
+    )
+}
+
+@OptIn(ExperimentalForeignApi::class)
+internal val queueAdded = staticCFunction { error: CPointer<ByteVar>?, state: COpaquePointer? ->
+    val ref = state!!.asStableRef<(Result<Unit>) -> Unit>()
+    val done = ref.get()
+    ref.dispose()
+    done(if (error == null) Result.success(Unit) else Result.failure(USearchException(error.toKString())))
+}
@@ -16,4 +16,6 @@ fun IndexOptions.native(): CValue<usearch_init_options_t> = cValue {
     expansion_add = this@native.expansionAdd
     expansion_search = this@native.expansionSearch
     multi = this@native.multi
+    thread_safe = this@native.threadSafe
+    key_lookups = this@native.keyLookups.nativeEnum
 }
\ No newline at end of file
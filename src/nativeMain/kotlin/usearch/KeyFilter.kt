@@ -0,0 +1,35 @@
+package usearch
+
+import kotlinx.cinterop.*
+import lib.*
+import kotlin.experimental.ExperimentalNativeApi
+import kotlin.native.ref.Cleaner
+import kotlin.native.ref.createCleaner
+
+@OptIn(ExperimentalForeignApi::class)
+actual enum class FilterKind(val nativeEnum: UInt) {
+    Bitset(usearch_filter_bitset_k), Sorted(usearch_filter_sorted_k), Hash(usearch_filter_hash_k)
+}
+
+@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class, ExperimentalUnsignedTypes::class)
+actual class KeyFilter actual constructor(keys: ULongArray, kind: FilterKind, exclude: Boolean) {
+    internal val ptr: COpaquePointer = errorScoped {
+        if (keys.isEmpty()) {
+            usearch_filter_init(kind.nativeEnum, null, 0u, exclude, err)
+        } else {
+            keys.usePinned {
+                usearch_filter_init(kind.nativeEnum, it.addressOf(0), keys.size.toULong(), exclude, err)
+            }
+        }
+    } ?: error("No error returned while filter ptr is null.")
+
+    private val cleaner: Cleaner = createCleaner(ptr) {
+        try {
+            errorScoped {
+                usearch_filter_free(it, err)
+            }
+        } catch (e: IllegalStateException) {
+            println("Error calling usearch_filter_free: ${e.message}")
+        }
+    }
+}
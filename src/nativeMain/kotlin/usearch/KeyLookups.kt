@@ -0,0 +1,9 @@
+package usearch
+
+import kotlinx.cinterop.ExperimentalForeignApi
+import lib.*
+
+@OptIn(ExperimentalForeignApi::class)
+actual enum class KeyLookups(val nativeEnum: UInt) {
+    Hash(usearch_key_lookups_hash_k), None(usearch_key_lookups_none_k), Identity(usearch_key_lookups_identity_k)
+}
@@ -7,6 +7,9 @@ actual data class Matches(
     actual val keys: List<ULong>,
     actual val distances: List<Float>
 ) : Iterable<Match> {
+    actual constructor(keys: ULongArray, distances: FloatArray, size: Int) :
+            this(ULongArrayView(keys, size), FloatArrayView(distances, size))
+
     override fun equals(other: Any?): Boolean {
         if (this === other) return true
         if (other == null || this::class != other::class) return false
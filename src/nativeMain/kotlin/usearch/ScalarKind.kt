@@ -4,7 +4,7 @@ import kotlinx.cinterop.ExperimentalForeignApi
 import lib.*
 
 @OptIn(ExperimentalForeignApi::class)
-actual enum class ScalarKind(val nativeEnum: UInt) {
-    F64(usearch_scalar_f64_k), F32(usearch_scalar_f32_k), F16(usearch_scalar_f16_k),
-    I8(usearch_scalar_i8_k), B1(usearch_scalar_b1_k)
+actual enum class ScalarKind(val nativeEnum: UInt, val bytes: Int) {
+    F64(usearch_scalar_f64_k, 8), F32(usearch_scalar_f32_k, 4), F16(usearch_scalar_f16_k, 2),
+    I8(usearch_scalar_i8_k, 1), B1(usearch_scalar_b1_k, 1)
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+package usearch
+
+import kotlinx.cinterop.*
+import lib.*
+import kotlin.experimental.ExperimentalNativeApi
+import kotlin.native.ref.Cleaner
+import kotlin.native.ref.createCleaner
+
+/**
+ * Results are kept in native memory, where the C API writes them directly,
+ * along with the error slot, so searching into it needs no scoped allocation either.
+ */
+@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class, ExperimentalUnsignedTypes::class)
+actual class SearchBuffer actual constructor(actual val capacity: Int) {
+    private val memory = Memory(capacity)
+
+    internal val keys: CPointer<usearch_key_tVar> get() = memory.keys
+    internal val distances: CPointer<FloatVar> get() = memory.distances
+    internal val error: usearch_error_tVar get() = memory.error
+
+    actual var size: Int = 0
+        internal set
+
+    private val cleaner: Cleaner = createCleaner(memory, Memory::free)
+
+    actual fun key(index: Int): ULong = keys[checkIndex(index)]
+
+    actual fun distance(index: Int): Float = distances[checkIndex(index)]
+
+    actual fun toMatches(): Matches =
+        Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+
+    /**
+     * Throws the error reported by the last call, if any, then clears it for the next one.
+     */
+    internal fun rethrow() {
+        val message = error.value?.toKString() ?: return
+        error.value = null
+        throw USearchException(message)
+    }
+
+    private class Memory(capacity: Int) {
+        val keys = nativeHeap.allocArray<usearch_key_tVar>(capacity)
+        val distances = nativeHeap.allocArray<FloatVar>(capacity)
+        val error = nativeHeap.alloc<usearch_error_tVar>().apply { value = null }
+
+        fun free() {
+            nativeHeap.free(keys)
+            nativeHeap.free(distances)
+            nativeHeap.free(error)
+        }
+    }
+}
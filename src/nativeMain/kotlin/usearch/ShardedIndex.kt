@@ -0,0 +1,127 @@
+package usearch
+
+import kotlinx.cinterop.*
+import lib.*
+import kotlin.experimental.ExperimentalNativeApi
+import kotlin.native.ref.Cleaner
+import kotlin.native.ref.createCleaner
+
+@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class, ExperimentalUnsignedTypes::class)
+actual class ShardedIndex actual constructor(options: IndexOptions, actual val shards: Int) {
+    init {
+        if (shards <= 0) {
+            throw IllegalArgumentException("At least one shard is required.")
+        }
+    }
+
+    private val dimensions: Int = options.dimensions.toInt()
+
+    private val ptr: COpaquePointer = errorScoped {
+        usearch_sharded_init(options.native(), shards.toULong(), err)
+    } ?: error("No error returned while sharded index ptr is null.")
+
+    private val cleaner: Cleaner = createCleaner(ptr) {
+        try {
+            errorScoped {
+                usearch_sharded_free(it, err)
+            }
+        } catch (e: IllegalStateException) {
+            println("Error calling usearch_sharded_free: ${e.message}")
+        }
+    }
+
+    actual val size: ULong
+        get() = errorScoped {
+            usearch_sharded_size(ptr, err)
+        }
+
+    actual fun add(key: ULong, vec: FloatArray) {
+        if (vec.size != dimensions) {
+            throw IllegalArgumentException("Vector has ${vec.size} scalars instead of $dimensions.")
+        }
+        errorScoped {
+            vec.usePinned {
+                usearch_sharded_add(ptr, key, it.addressOf(0), usearch_scalar_f32_k, err)
+            }
+        }
+    }
+
+    actual fun addAll(keys: ULongArray, matrix: FloatArray) {
+        if (keys.isEmpty()) {
+            return
+        }
+        if (matrix.size != keys.size * dimensions) {
+            throw IllegalArgumentException(
+                "Cannot split ${matrix.size} scalars into ${keys.size} $dimensions-dimensional vectors."
+            )
+        }
+        errorScoped {
+            keys.usePinned { k ->
+                matrix.usePinned {
+                    usearch_sharded_add_batch(
+                        ptr,
+                        k.addressOf(0),
+                        it.addressOf(0),
+                        keys.size.toULong(),
+                        (dimensions * Float.SIZE_BYTES).toULong(),
+                        usearch_scalar_f32_k,
+                        err
+                    )
+                }
+            }
+        }
+    }
+
+    actual fun remove(key: ULong) {
+        errorScoped {
+            usearch_sharded_remove(ptr, key, err)
+        }
+    }
+
+    actual operator fun contains(key: ULong): Boolean = errorScoped {
+        usearch_sharded_contains(ptr, key, err)
+    }
+
+    actual fun search(query: FloatArray, count: Int): Matches {
+        if (query.size != dimensions) {
+            throw IllegalArgumentException("Query has ${query.size} scalars instead of $dimensions.")
+        }
+        return errorScoped {
+            val keys = allocArray<usearch_key_tVar>(count)
+            val distances = allocArray<FloatVar>(count)
+            val size = query.usePinned {
+                usearch_sharded_search(
+                    ptr, it.addressOf(0), usearch_scalar_f32_k, count.toULong(), keys, distances, err
+                )
+            }.toInt()
+            Matches(ULongArray(size) { keys[it] }, FloatArray(size) { distances[it] }, size)
+        }
+    }
+
+    actual fun saveShard(shard: Int, filePath: String) {
+        errorScoped {
+            usearch_save(shard(shard), filePath, err)
+        }
+    }
+
+    actual fun loadShard(shard: Int, filePath: String) {
+        errorScoped {
+            usearch_load(shard(shard), filePath, err)
+        }
+    }
+
+    actual fun viewShard(shard: Int, filePath: String, advice: ViewAdvice) {
+        errorScoped {
+            usearch_view_file(shard(shard), filePath, advice.nativeEnum, err)
+        }
+    }
+
+    private fun shard(shard: Int): COpaquePointer {
+        if (shard !in 0 until shards) {
+            throw IndexOutOfBoundsException("Shard $shard out of range for $shards shards.")
+        }
+        return errorScoped {
+            usearch_sharded_shard(ptr, shard.toULong(), err)
+        } ?: error("No error returned while shard ptr is null.")
+    }
+}
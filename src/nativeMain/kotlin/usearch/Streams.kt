@@ -0,0 +1,71 @@
+@file:OptIn(ExperimentalForeignApi::class)
+
+package usearch
+
+import kotlinx.cinterop.*
+import platform.posix.memcpy
+
+/**
+ * State shared with the C stream callbacks, which can't capture anything.
+ * Exceptions must not unwind through C frames, so they are parked in [failure] and rethrown afterward.
+ */
+internal class StreamState(bufferSize: Int, val transfer: (buffer: ByteArray, length: Int) -> Int) {
+    val buffer = if (bufferSize > 0) ByteArray(bufferSize) else throw IllegalArgumentException("Stream buffer is empty.")
+    var failure: Throwable? = null
+
+    inline fun <T> use(block: (COpaquePointer) -> T): T {
+        val ref = StableRef.create(this)
+        try {
+            val result = try {
+                block(ref.asCPointer())
+            } catch (e: USearchException) {
+                throw failure ?: e
+            }
+            failure?.let { throw it }
+            return result
+        } finally {
+            ref.dispose()
+        }
+    }
+}
+
+internal val streamWrite = staticCFunction { data: COpaquePointer?, length: ULong, state: COpaquePointer? ->
+    val stream = state!!.asStableRef<StreamState>().get()
+    val bytes = data!!.reinterpret<ByteVar>()
+    try {
+        var offset = 0uL
+        while (offset < length) {
+            val chunk = minOf(length - offset, stream.buffer.size.toULong())
+            stream.buffer.usePinned { memcpy(it.addressOf(0), bytes + offset.toLong(), chunk) }
+            stream.transfer(stream.buffer, chunk.toInt())
+            offset += chunk
+        }
+        true
+    } catch (e: Throwable) {
+        stream.failure = e
+        false
+    }
+}
+
+internal val streamRead = staticCFunction { data: COpaquePointer?, length: ULong, state: COpaquePointer? ->
+    val stream = state!!.asStableRef<StreamState>().get()
+    val bytes = data!!.reinterpret<ByteVar>()
+    try {
+        var offset = 0uL
+        var ended = false
+        while (offset < length && !ended) {
+            val chunk = minOf(length - offset, stream.buffer.size.toULong()).toInt()
+            val read = stream.transfer(stream.buffer, chunk)
+            if (read in 1..chunk) {
+                stream.buffer.usePinned { memcpy(bytes + offset.toLong(), it.addressOf(0), read.toULong()) }
+                offset += read.toULong()
+            } else {
+                ended = true
+            }
+        }
+        !ended
+    } catch (e: Throwable) {
+        stream.failure = e
+        false
+    }
+}
@@ -0,0 +1,97 @@
+package usearch
+
+import kotlinx.cinterop.*
+import lib.*
+import platform.posix.memcpy
+import kotlin.experimental.ExperimentalNativeApi
+import kotlin.native.ref.Cleaner
+import kotlin.native.ref.createCleaner
+
+@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class)
+actual class VectorStore private constructor(
+    internal val ptr: COpaquePointer?,
+    internal val kind: ScalarKind,
+    internal val fetch: ((key: ULong, vector: FloatArray) -> Boolean)?
+) {
+    private val cleaner: Cleaner = createCleaner(ptr) {
+        if (it != null) {
+            try {
+                errorScoped {
+                    usearch_store_free(it, err)
+                }
+            } catch (e: IllegalStateException) {
+                println("Error calling usearch_store_free: ${e.message}")
+            }
+        }
+    }
+
+    /**
+     * Runs [block] with the native store. Stores reading through [fetch] get a temporary one,
+     * whose callback parks exceptions instead of unwinding them through C frames.
+     */
+    internal inline fun <T> use(dimensions: Int, block: (usearch_store_t) -> T): T {
+        ptr?.let { return block(it) }
+        val state = FetchState(dimensions, fetch!!)
+        val ref = StableRef.create(state)
+        try {
+            val store = errorScoped {
+                usearch_store_init_callback(storeFetch, ref.asCPointer(), kind.nativeEnum, dimensions.toULong(), err)
+            } ?: error("No error returned while store ptr is null.")
+            try {
+                val result = try {
+                    block(store)
+                } catch (e: USearchException) {
+                    throw state.failure ?: e
+                }
+                state.failure?.let { throw it }
+                return result
+            } finally {
+                errorScoped {
+                    usearch_store_free(store, err)
+                }
+            }
+        } finally {
+            ref.dispose()
+        }
+    }
+
+    actual companion object {
+        actual fun mapFile(filePath: String, dimensions: ULong, kind: ScalarKind): VectorStore {
+            if (kind != ScalarKind.F32 && kind != ScalarKind.F64) {
+                throw IllegalArgumentException("Full-precision vectors must be F32 or F64, not $kind.")
+            }
+            val ptr = errorScoped {
+                usearch_store_map_file(filePath, kind.nativeEnum, dimensions, err)
+            } ?: error("No error returned while store ptr is null.")
+            return VectorStore(ptr, kind, null)
+        }
+
+        actual fun fetching(fetch: (key: ULong, vector: FloatArray) -> Boolean): VectorStore =
+            VectorStore(null, ScalarKind.F32, fetch)
+    }
+}
+
+internal class FetchState(dimensions: Int, val fetch: (key: ULong, vector: FloatArray) -> Boolean) {
+    val vector = FloatArray(dimensions)
+    var failure: Throwable? = null
+}
+
+@OptIn(ExperimentalForeignApi::class)
+internal val storeFetch = staticCFunction { key: ULong, vector: COpaquePointer?, state: COpaquePointer? ->
+    val fetch = state!!.asStableRef<FetchState>().get()
+    if (fetch.failure != null) {
+        return@staticCFunction false
+    }
+    try {
+        val found = fetch.fetch(key, fetch.vector)
+        if (found) {
+            fetch.vector.usePinned {
+                memcpy(vector, it.addressOf(0), (fetch.vector.size * Float.SIZE_BYTES).toULong())
+            }
+        }
+        found
+    } catch (e: Throwable) {
+        fetch.failure = e
+        false
+    }
+}
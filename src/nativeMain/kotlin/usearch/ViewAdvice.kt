@@ -0,0 +1,10 @@
+package usearch
+
+import kotlinx.cinterop.ExperimentalForeignApi
+import lib.*
+
+@OptIn(ExperimentalForeignApi::class)
+actual enum class ViewAdvice(val nativeEnum: UInt) {
+    Normal(usearch_view_normal_k), Random(usearch_view_random_k),
+    Sequential(usearch_view_sequential_k), WillNeed(usearch_view_willneed_k)
+}